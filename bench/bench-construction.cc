@@ -0,0 +1,73 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "bench.h"
+#include "typesetter.hh"
+
+#include <cstdio>
+#include <cstring>
+
+// The cost of creating a Typesetter, for code creating a short-lived one each time it lays out some text,
+// compared to laying out a single label.
+
+template <typename Function>
+static double MeasureMicroseconds(const BenchOptions &options, Function function) {
+  LatencyRecorder latencies;
+  auto start_time = LatencyRecorder::Clock::now();
+  do {
+    auto run_start_time = LatencyRecorder::Clock::now();
+    function();
+    latencies.Record(LatencyRecorder::Clock::now() - run_start_time);
+  } while (std::chrono::duration<double>(LatencyRecorder::Clock::now() - start_time).count() < options.min_seconds_per_case);
+  return latencies.PercentileInMicroseconds(0.50);
+}
+
+void RunConstructionBenchmarks(const BenchOptions &options, const BenchFonts &fonts) {
+  if (options.only_corpus != nullptr && std::strcmp(options.only_corpus, "construction") != 0) {
+    return;
+  }
+
+  static const char *kLabels[] = {"Cancel", "吾輩は猫である"};
+  std::printf("\n%-12s %-16s %16s %16s %16s\n", "construction", "label", "new (us)", "label (us)", "both (us)");
+  for (auto label : kLabels) {
+    glyphknit::TextBlock text_block{fonts.sans_serif, 12};
+    text_block.SetText(label);
+
+    // a Typesetter already used, so that nothing is cached by the first layout
+    glyphknit::Typesetter typesetter;
+    typesetter.PositionGlyphs(text_block, 1000);
+
+    auto construction_microseconds = MeasureMicroseconds(options, [] {
+      glyphknit::Typesetter new_typesetter;
+    });
+    auto label_microseconds = MeasureMicroseconds(options, [&] {
+      typesetter.PositionGlyphs(text_block, 1000);
+    });
+    auto both_microseconds = MeasureMicroseconds(options, [&] {
+      glyphknit::Typesetter new_typesetter;
+      new_typesetter.PositionGlyphs(text_block, 1000);
+    });
+    std::printf("%-12s %-16s %16.3f %16.3f %16.3f\n", "", label, construction_microseconds, label_microseconds, both_microseconds);
+  }
+}
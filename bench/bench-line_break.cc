@@ -0,0 +1,140 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "bench.h"
+#include "grapheme_cluster.hh"
+#include "line_break.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <unicode/ubrk.h>
+#include <unicode/ustring.h>
+
+// Finding the line break opportunities of paragraphs with FindLineBreakOpportunities and with an ICU line break iterator,
+// and their grapheme cluster boundaries with FindGraphemeClusterBoundaries and with an ICU character break iterator.
+
+struct LineBreakText {
+  const char *name;
+  std::vector<uint16_t> text;
+};
+
+static std::vector<uint16_t> ConvertToUTF16(const std::string &utf8_text) {
+  std::vector<uint16_t> text(utf8_text.size());
+  int32_t length;
+  UErrorCode status = U_ZERO_ERROR;
+  u_strFromUTF8(text.data(), int32_t(text.size()), &length, utf8_text.c_str(), int32_t(utf8_text.size()), &status);
+  text.resize(size_t(length));
+  return text;
+}
+
+static std::vector<LineBreakText> CreateTexts() {
+  std::vector<LineBreakText> texts;
+  texts.push_back(LineBreakText{
+    .name = "latin",
+    .text = ConvertToUTF16("Typesetting is the composition of text by means of arranging physical types or their digital equivalents. Stored letters and other symbols are retrieved and ordered according to a language's orthography for visual display. Ça coûte 12,50 € — « déjà vu »."),
+  });
+  texts.push_back(LineBreakText{
+    .name = "cjk",
+    .text = ConvertToUTF16("吾輩は猫である。名前はまだ無い。どこで生れたかとんと見当がつかぬ。何でも薄暗いじめじめした所でニャーニャー泣いていた事だけは記憶している。Unicode 7.0では、日本語と English が混ざった文章（mixed text）もよく使われます。"),
+  });
+  texts.push_back(LineBreakText{
+    .name = "bidi",
+    .text = ConvertToUTF16("مرحبا بكم في هذا الاختبار. هذا النص مكتوب باللغة العربية ويحتوي على بعض الكلمات الإنجليزية مثل Glyphknit و HarfBuzz وأرقام مثل 2014 و 3.14."),
+  });
+  texts.push_back(LineBreakText{
+    .name = "indic",
+    .text = ConvertToUTF16("यह एक परीक्षण अनुच्छेद है। हिंदी देवनागरी लिपि में लिखी जाती है और इसमें संयुक्ताक्षर जैसे क्ष, त्र और ज्ञ होते हैं। এটি একটি পরীক্ষামূলক অনুচ্ছেদ।"),
+  });
+  texts.push_back(LineBreakText{
+    .name = "emoji",
+    .text = ConvertToUTF16("Family: 👨‍👩‍👧‍👦, thumbs up 👍🏽, flags 🇫🇷🇯🇵 and smileys 😀😃😄 to celebrate!"),
+  });
+  texts.push_back(LineBreakText{
+    .name = "urls",
+    .text = ConvertToUTF16("See http://www.unicode.org/Public/7.0.0/ucd/auxiliary/LineBreakTest.txt and https://www.example.com/a/very/long/path/index.html?query=typesetting&page=42#section-7 for details."),
+  });
+  std::string long_text;
+  while (long_text.size() < 100000) {
+    long_text += "typesetting is the composition of text by means of arranging physical types (12.5%) or their digital equivalents; ";
+  }
+  texts.push_back(LineBreakText{
+    .name = "long",
+    .text = ConvertToUTF16(long_text),
+  });
+  return texts;
+}
+
+template <typename Function>
+static double MeasureNanosecondsPerCodeUnit(const BenchOptions &options, size_t length, Function function) {
+  LatencyRecorder latencies;
+  auto start_time = LatencyRecorder::Clock::now();
+  do {
+    auto find_start_time = LatencyRecorder::Clock::now();
+    function();
+    latencies.Record(LatencyRecorder::Clock::now() - find_start_time);
+  } while (std::chrono::duration<double>(LatencyRecorder::Clock::now() - start_time).count() < options.min_seconds_per_case);
+  return latencies.PercentileInMicroseconds(0.50) * 1e3 / double(length);
+}
+
+template <typename Function>
+static void CompareWithIcu(const BenchOptions &options, const char *corpus_name, UBreakIteratorType icu_iterator_type, Function find) {
+  if (options.only_corpus != nullptr && std::strcmp(options.only_corpus, corpus_name) != 0) {
+    return;
+  }
+
+  UErrorCode status = U_ZERO_ERROR;
+  auto icu_iterator = ubrk_open(icu_iterator_type, "en", nullptr, 0, &status);
+  if (U_FAILURE(status)) {
+    std::fprintf(stderr, "could not open the break iterator: %s\n", u_errorName(status));
+    return;
+  }
+
+  std::printf("%-10s %8s %14s %14s %8s\n", corpus_name, "length", "ICU (ns/unit)", "ours (ns/unit)", "speedup");
+  for (const auto &text : CreateTexts()) {
+    auto length = text.text.size();
+    std::vector<uint64_t> bits(length / 64 + 1);
+    auto icu_nanoseconds = MeasureNanosecondsPerCodeUnit(options, length, [&] {
+      std::fill(bits.begin(), bits.end(), 0);
+      UErrorCode status = U_ZERO_ERROR;
+      ubrk_setText(icu_iterator, text.text.data(), int32_t(length), &status);
+      for (auto boundary = ubrk_first(icu_iterator); boundary != UBRK_DONE; boundary = ubrk_next(icu_iterator)) {
+        bits[size_t(boundary) / 64] |= uint64_t(1) << (size_t(boundary) % 64);
+      }
+    });
+    auto icu_bits = bits;
+    auto our_nanoseconds = MeasureNanosecondsPerCodeUnit(options, length, [&] {
+      std::fill(bits.begin(), bits.end(), 0);
+      find(text.text.data(), ssize_t(length), bits.data());
+    });
+    std::printf("%-10s %8zu %14.2f %14.2f %7.1fx%s\n", text.name, length, icu_nanoseconds, our_nanoseconds, icu_nanoseconds / our_nanoseconds,
+                bits == icu_bits ? "" : "  (different boundaries!)");
+  }
+  ubrk_close(icu_iterator);
+}
+
+void RunLineBreakBenchmarks(const BenchOptions &options, const BenchFonts &) {
+  CompareWithIcu(options, "linebreak", UBRK_LINE, glyphknit::FindLineBreakOpportunities);
+  CompareWithIcu(options, "graphemes", UBRK_CHARACTER, glyphknit::FindGraphemeClusterBoundaries);
+}
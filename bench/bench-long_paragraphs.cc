@@ -0,0 +1,107 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "bench.h"
+#include "typesetter.hh"
+
+#include <cstdio>
+#include <cstring>
+
+// Long paragraphs of a single run, to check that the cost of laying out a line does not depend on the length of the paragraph,
+// and long tokens without any line break opportunity that have to be cut between grapheme clusters.
+
+static const size_t kParagraphLengths[] = {10000, 100000, 1000000};
+static const size_t kTokenLength = 10000;
+static const double kLongParagraphWidth = 400;
+
+static std::string CreateLongParagraph(size_t length) {
+  static const char *kWords[] = {
+    "typesetting", "is", "the", "composition", "of", "text", "by", "means", "of", "arranging", "physical", "types", "or", "their", "digital", "equivalents",
+  };
+  std::string paragraph;
+  paragraph.reserve(length + 16);
+  size_t word_index = 0;
+  while (paragraph.size() < length) {
+    paragraph += kWords[word_index++ % (sizeof(kWords) / sizeof(kWords[0]))];
+    paragraph += ' ';
+  }
+  paragraph.resize(length);
+  return paragraph;
+}
+
+// like a base64 blob, with some ligatures (in the serif font) so that some glyph clusters contain multiple grapheme clusters
+static std::string CreateLongToken(size_t length) {
+  static const char kCharacters[] = "aGVsbG8gd29ybGQffiZmluYW5jZQ0xTflmFzZTY0fi";
+  std::string token;
+  token.reserve(length);
+  for (size_t index = 0; index < length; ++index) {
+    token += kCharacters[index % (sizeof(kCharacters) - 1)];
+  }
+  return token;
+}
+
+// with limits, only the first lines are laid out (like a preview of a long comment)
+static void RunLongParagraphBenchmark(glyphknit::Typesetter &typesetter, const BenchOptions &options, const char *name, glyphknit::TextBlock &text_block, size_t length, const glyphknit::LayoutLimits *limits = nullptr) {
+  LatencyRecorder latencies;
+  size_t lines_count = 0;
+  auto start_time = LatencyRecorder::Clock::now();
+  do {
+    auto paragraph_start_time = LatencyRecorder::Clock::now();
+    bool truncated;
+    lines_count = (limits == nullptr ? typesetter.PositionGlyphs(text_block, kLongParagraphWidth) : typesetter.PositionGlyphs(text_block, kLongParagraphWidth, *limits, &truncated)).size();
+    latencies.Record(LatencyRecorder::Clock::now() - paragraph_start_time);
+  } while (std::chrono::duration<double>(LatencyRecorder::Clock::now() - start_time).count() < options.min_seconds_per_case);
+
+  auto microseconds = latencies.PercentileInMicroseconds(0.50);
+  std::printf("%-10s %8zu %8zu %12.2f %12.2f\n", name, length, lines_count, microseconds / 1e3, microseconds / double(lines_count));
+}
+
+void RunLongParagraphBenchmarks(const BenchOptions &options, const BenchFonts &fonts) {
+  if (options.only_corpus != nullptr && std::strcmp(options.only_corpus, "long") != 0) {
+    return;
+  }
+
+  glyphknit::Typesetter typesetter;
+  std::printf("\n%-10s %8s %8s %12s %12s\n", "corpus", "length", "lines", "total (ms)", "per line (us)");
+  for (auto length : kParagraphLengths) {
+    glyphknit::TextBlock text_block{fonts.serif, 13};
+    text_block.SetText(CreateLongParagraph(length).c_str());
+    RunLongParagraphBenchmark(typesetter, options, "long", text_block, length);
+  }
+
+  glyphknit::LayoutLimits limits;
+  limits.max_lines = 3;
+  limits.ellipsis = true;
+  for (auto length : kParagraphLengths) {
+    glyphknit::TextBlock text_block{fonts.serif, 13};
+    text_block.SetText(CreateLongParagraph(length).c_str());
+    RunLongParagraphBenchmark(typesetter, options, "clamp", text_block, length, &limits);
+  }
+
+  for (auto font_descriptor : {fonts.serif, fonts.monospace}) {
+    glyphknit::TextBlock text_block{font_descriptor, 13};
+    text_block.SetText(CreateLongToken(kTokenLength).c_str());
+    RunLongParagraphBenchmark(typesetter, options, "token", text_block, kTokenLength);
+  }
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "bench.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+double LatencyRecorder::total_seconds() const {
+  int64_t total = 0;
+  for (auto duration : durations_) {
+    total += duration;
+  }
+  return double(total) / 1e9;
+}
+
+double LatencyRecorder::PercentileInMicroseconds(double percentile) const {
+  if (durations_.empty()) {
+    return 0;
+  }
+  auto sorted_durations = durations_;
+  auto index = size_t(percentile * double(sorted_durations.size() - 1) + 0.5);
+  std::nth_element(sorted_durations.begin(), sorted_durations.begin()+index, sorted_durations.end());
+  return double(sorted_durations[index]) / 1e3;
+}
+
+void PrintResultsHeader() {
+  std::printf("%-10s %6s %14s %14s %10s %10s\n", "corpus", "width", "paragraphs/s", "glyphs/s", "p50 (us)", "p99 (us)");
+}
+
+void PrintResults(const char *corpus_name, double width, const LatencyRecorder &latencies, size_t glyphs_count) {
+  auto total_seconds = latencies.total_seconds();
+  std::printf("%-10s %6.0f %14.0f %14.0f %10.2f %10.2f\n", corpus_name, width,
+              double(latencies.count()) / total_seconds, double(glyphs_count) / total_seconds,
+              latencies.PercentileInMicroseconds(0.50), latencies.PercentileInMicroseconds(0.99));
+}
+
+void PrintStats(const glyphknit::TypesetStats &stats) {
+  using glyphknit::TypesetStats;
+  auto total_nanoseconds = stats.total_nanoseconds();
+  for (int phase = 0; phase < TypesetStats::kPhasesCount; ++phase) {
+    auto nanoseconds = stats.phase_nanoseconds[phase];
+    std::printf("    %-20s %10.2f us %5.1f%%\n", TypesetStats::PhaseName(TypesetStats::Phase(phase)),
+                double(nanoseconds) / 1e3, total_nanoseconds == 0 ? 0 : 100.0 * double(nanoseconds) / double(total_nanoseconds));
+  }
+  std::printf("    shape calls per paragraph: %.2f (max %lld)\n", stats.shape_calls_per_paragraph(), (long long)stats.max_shape_calls_per_paragraph);
+  std::printf("    line break reshapes: %lld, safe line breaks: %lld, grapheme cluster breaks: %lld\n",
+              (long long)stats.line_break_reshapes_count, (long long)stats.safe_line_breaks_count, (long long)stats.grapheme_cluster_breaks_count);
+  for (const auto &font_retries : stats.fallback_retries_per_font) {
+    std::printf("    fallback retries for %s: %lld\n", font_retries.first.c_str(), (long long)font_retries.second);
+  }
+}
+
+static glyphknit::FontDescriptor LoadFont(const std::string &fonts_directory, const char *file_name) {
+  auto path = fonts_directory + "/" + file_name;
+  auto font_descriptor = glyphknit::FontManager::CreateDescriptorFromLocalFile(path.c_str());
+  if (!font_descriptor.is_valid()) {
+    std::fprintf(stderr, "could not load font %s\n", path.c_str());
+    std::exit(1);
+  }
+  return font_descriptor;
+}
+
+static void PrintUsage(const char *program_name) {
+  std::fprintf(stderr, "usage: %s [--corpus=NAME] [--min-time=SECONDS] [--fonts=DIRECTORY] [--stats] [--shaping-cache[=KILOBYTES]]\n", program_name);
+}
+
+int main(int argc, char **argv) {
+  BenchOptions options = {
+    .min_seconds_per_case = 0.2,
+    .only_corpus = nullptr,
+    .print_stats = false,
+    .shaping_cache_budget = 0,
+  };
+  std::string fonts_directory = GLYPHKNIT_FONTS_DIRECTORY;
+
+  for (int i = 1; i < argc; ++i) {
+    if (std::strncmp(argv[i], "--corpus=", 9) == 0) {
+      options.only_corpus = argv[i] + 9;
+    }
+    else if (std::strncmp(argv[i], "--min-time=", 11) == 0) {
+      options.min_seconds_per_case = std::atof(argv[i] + 11);
+    }
+    else if (std::strncmp(argv[i], "--fonts=", 8) == 0) {
+      fonts_directory = argv[i] + 8;
+    }
+    else if (std::strcmp(argv[i], "--stats") == 0) {
+      options.print_stats = true;
+    }
+    else if (std::strcmp(argv[i], "--shaping-cache") == 0) {
+      options.shaping_cache_budget = glyphknit::ShapingCache::kDefaultMemoryBudget;
+    }
+    else if (std::strncmp(argv[i], "--shaping-cache=", 16) == 0) {
+      options.shaping_cache_budget = size_t(std::atof(argv[i] + 16) * 1024);
+    }
+    else {
+      PrintUsage(argv[0]);
+      return 1;
+    }
+  }
+
+  BenchFonts fonts = {
+    .sans_serif = LoadFont(fonts_directory, "dejavu/DejaVuSans.ttf"),
+    .serif = LoadFont(fonts_directory, "dejavu/DejaVuSerif.ttf"),
+    .monospace = LoadFont(fonts_directory, "dejavu/DejaVuSansMono.ttf"),
+  };
+
+  RunTypesetBenchmarks(options, fonts);
+  RunLongParagraphBenchmarks(options, fonts);
+  RunResizeBenchmarks(options, fonts);
+  RunEditBenchmarks(options, fonts);
+  RunLineBreakBenchmarks(options, fonts);
+  RunConstructionBenchmarks(options, fonts);
+  RunOptimalLineBreakingBenchmarks(options, fonts);
+  return 0;
+}
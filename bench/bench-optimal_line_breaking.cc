@@ -0,0 +1,94 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+
+#include "bench.h"
+#include "typesetter.hh"
+
+#include <cstdio>
+#include <cstring>
+#include <functional>
+
+// Overhead of the total-fit line breaking (ShapedParagraph::BreakLinesOptimally) compared to the greedy one on the same paragraphs:
+// only breaking the lines of paragraphs already shaped, and the whole layout with Typesetter::PositionGlyphs.
+
+static const size_t kOptimalParagraphLengths[] = {1000, 10000, 100000};
+static const double kOptimalWidths[] = {150, 400, 1000};
+
+static std::string CreateParagraph(size_t length) {
+  static const char *kSentences[] = {
+    "It is being written with interactive (editable) text as a goal, so laying out a paragraph has to be fast enough to be done again after each keystroke. ",
+    "The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs! How vexingly quick daft zebras jump; sphinx of black quartz, judge my vow. ",
+    "Typesetting is the composition of text by means of arranging physical types or their digital equivalents. ",
+    "See http://www.unicode.org/Public/7.0.0/ucd/auxiliary/LineBreakTest.txt for details. ",
+  };
+  std::string paragraph;
+  for (size_t sentence_index = 0; paragraph.size() < length; ++sentence_index) {
+    paragraph += kSentences[sentence_index % (sizeof(kSentences) / sizeof(kSentences[0]))];
+  }
+  paragraph.resize(length);
+  return paragraph;
+}
+
+static double MeasureMedian(const BenchOptions &options, const std::function<void()> &function) {
+  LatencyRecorder latencies;
+  auto start_time = LatencyRecorder::Clock::now();
+  do {
+    auto call_start_time = LatencyRecorder::Clock::now();
+    function();
+    latencies.Record(LatencyRecorder::Clock::now() - call_start_time);
+  } while (std::chrono::duration<double>(LatencyRecorder::Clock::now() - start_time).count() < options.min_seconds_per_case);
+  return latencies.PercentileInMicroseconds(0.50);
+}
+
+void RunOptimalLineBreakingBenchmarks(const BenchOptions &options, const BenchFonts &fonts) {
+  if (options.only_corpus != nullptr && std::strcmp(options.only_corpus, "optimal") != 0) {
+    return;
+  }
+
+  glyphknit::Typesetter typesetter;
+  glyphknit::ShapedParagraph::OptimalLineBreakingParameters parameters;
+  std::printf("\n%-10s %8s %6s %8s %8s %12s %12s %14s %14s\n", "corpus", "length", "width", "greedy", "optimal", "greedy (us)", "optimal (us)", "layout (ms)", "optimal (ms)");
+  for (auto length : kOptimalParagraphLengths) {
+    glyphknit::TextBlock text_block{fonts.serif, 13};
+    text_block.SetText(CreateParagraph(length).c_str());
+    auto paragraph = typesetter.ShapeParagraph(text_block, 0, text_block.text_length());
+
+    for (auto width : kOptimalWidths) {
+      size_t greedy_lines_count = paragraph.BreakLines(width).size();
+      size_t optimal_lines_count = paragraph.BreakLinesOptimally(width, parameters).size();
+      auto greedy_microseconds = MeasureMedian(options, [&] { paragraph.BreakLines(width); });
+      auto optimal_microseconds = MeasureMedian(options, [&] { paragraph.BreakLinesOptimally(width, parameters); });
+
+      typesetter.set_optimal_line_breaking(nullptr);
+      auto layout_microseconds = MeasureMedian(options, [&] { typesetter.PositionGlyphs(text_block, width); });
+      typesetter.set_optimal_line_breaking(&parameters);
+      auto optimal_layout_microseconds = MeasureMedian(options, [&] { typesetter.PositionGlyphs(text_block, width); });
+      typesetter.set_optimal_line_breaking(nullptr);
+
+      std::printf("%-10s %8zu %6.0f %8zu %8zu %12.2f %12.2f %14.3f %14.3f\n", "optimal", length, width, greedy_lines_count, optimal_lines_count,
+                  greedy_microseconds, optimal_microseconds, layout_microseconds / 1e3, optimal_layout_microseconds / 1e3);
+    }
+  }
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "bench.h"
+#include "layout_session.hh"
+#include "text_layout.hh"
+
+#include <cstdio>
+#include <cstring>
+#include <functional>
+
+// Live resize of a document: laying it out again at a slightly different width each time,
+// from scratch with Typesetter::PositionGlyphs, and with a TextLayout that only breaks the lines again.
+// And typing in a document, laying it out from scratch or updating a LayoutSession after each keystroke.
+
+static const size_t kDocumentParagraphsCounts[] = {10, 100, 1000};
+static const double kResizeWidths[] = {400, 410, 420, 430, 440, 450, 460, 470, 480, 490};
+
+static std::string CreateDocument(size_t paragraphs_count, const char *paragraph_separator = "\n") {
+  static const char *kParagraphs[] = {
+    "It is being written with interactive (editable) text as a goal, so laying out a paragraph has to be fast enough to be done again after each keystroke.",
+    "The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs! How vexingly quick daft zebras jump; sphinx of black quartz, judge my vow.",
+    "Typesetting is the composition of text by means of arranging physical types or their digital equivalents. Stored letters and other symbols are retrieved and ordered according to a language's orthography for visual display.",
+    "The title of the book is \"كتاب الحيوان\" and it was written in the 9th century (see page 123).",
+  };
+  std::string document;
+  for (size_t paragraph_index = 0; paragraph_index < paragraphs_count; ++paragraph_index) {
+    document += kParagraphs[paragraph_index % (sizeof(kParagraphs) / sizeof(kParagraphs[0]))];
+    document += paragraph_separator;
+  }
+  return document;
+}
+
+template <typename Layout>
+static double MeasureResizes(const BenchOptions &options, Layout layout) {
+  LatencyRecorder latencies;
+  size_t width_index = 0;
+  auto start_time = LatencyRecorder::Clock::now();
+  do {
+    auto resize_start_time = LatencyRecorder::Clock::now();
+    layout(kResizeWidths[width_index++ % (sizeof(kResizeWidths) / sizeof(kResizeWidths[0]))]);
+    latencies.Record(LatencyRecorder::Clock::now() - resize_start_time);
+  } while (std::chrono::duration<double>(LatencyRecorder::Clock::now() - start_time).count() < options.min_seconds_per_case);
+  return latencies.PercentileInMicroseconds(0.50);
+}
+
+void RunResizeBenchmarks(const BenchOptions &options, const BenchFonts &fonts) {
+  if (options.only_corpus != nullptr && std::strcmp(options.only_corpus, "resize") != 0) {
+    return;
+  }
+
+  glyphknit::Typesetter typesetter;
+  std::printf("\n%-10s %10s %8s %14s %14s %14s\n", "corpus", "paragraphs", "lines", "full (ms)", "relayout (ms)", "shaping (ms)");
+  for (auto paragraphs_count : kDocumentParagraphsCounts) {
+    glyphknit::TextBlock text_block{fonts.serif, 13};
+    text_block.SetText(CreateDocument(paragraphs_count).c_str());
+
+    auto shaping_start_time = LatencyRecorder::Clock::now();
+    glyphknit::TextLayout text_layout{typesetter, text_block};
+    auto shaping_seconds = std::chrono::duration<double>(LatencyRecorder::Clock::now() - shaping_start_time).count();
+    auto lines_count = text_layout.PositionGlyphs(kResizeWidths[0]).size();
+
+    auto full_microseconds = MeasureResizes(options, [&](double width) { typesetter.PositionGlyphs(text_block, width); });
+    auto relayout_microseconds = MeasureResizes(options, [&](double width) { text_layout.PositionGlyphs(width); });
+    std::printf("%-10s %10zu %8zu %14.3f %14.3f %14.3f\n", "resize", paragraphs_count, lines_count, full_microseconds / 1e3, relayout_microseconds / 1e3, shaping_seconds * 1e3);
+  }
+}
+
+void RunEditBenchmarks(const BenchOptions &options, const BenchFonts &fonts) {
+  if (options.only_corpus != nullptr && std::strcmp(options.only_corpus, "edit") != 0) {
+    return;
+  }
+
+  const double kWidth = 400;
+  glyphknit::Typesetter typesetter;
+  glyphknit::ShapingCache shaping_cache{options.shaping_cache_budget};
+  if (options.shaping_cache_budget > 0) {
+    typesetter.set_shaping_cache(&shaping_cache);
+  }
+  std::printf("\n%-10s %10s %8s %14s %14s\n", "corpus", "paragraphs", "lines", "full (ms)", "session (ms)");
+  // documents of paragraphs of a few lines, and of a single long paragraph (the sentences being separated by spaces instead of new lines)
+  for (auto paragraph_separator : {"\n", " "}) {
+    for (auto paragraphs_count : kDocumentParagraphsCounts) {
+      glyphknit::TextBlock text_block{fonts.serif, 13};
+      text_block.SetText(CreateDocument(paragraphs_count, paragraph_separator).c_str());
+      glyphknit::LayoutSession session{typesetter, text_block};
+      session.Update(kWidth);
+
+      // typing then deleting a character in the middle of the document
+      auto edit_index = text_block.text_length() / 2;
+      auto MeasureKeystrokes = [&](const std::function<void()> &layout) {
+        LatencyRecorder latencies;
+        auto start_time = LatencyRecorder::Clock::now();
+        do {
+          auto keystroke_start_time = LatencyRecorder::Clock::now();
+          if (latencies.count() % 2 == 0) {
+            text_block.ReplaceText(edit_index, edit_index, "x");
+          }
+          else {
+            text_block.ReplaceText(edit_index, edit_index + 1, "");
+          }
+          layout();
+          latencies.Record(LatencyRecorder::Clock::now() - keystroke_start_time);
+        } while (std::chrono::duration<double>(LatencyRecorder::Clock::now() - start_time).count() < options.min_seconds_per_case || latencies.count() % 2 != 0);
+        return latencies.PercentileInMicroseconds(0.50);
+      };
+      auto full_microseconds = MeasureKeystrokes([&] { typesetter.PositionGlyphs(text_block, kWidth); });
+      auto session_microseconds = MeasureKeystrokes([&] { session.Update(kWidth); });
+      std::printf("%-10s %10zu %8zu %14.3f %14.3f\n", "edit", session.paragraphs().size(), session.lines_count(), full_microseconds / 1e3, session_microseconds / 1e3);
+    }
+  }
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "bench.h"
+#include "typesetter.hh"
+
+#include <cstdio>
+#include <cstring>
+#include <list>
+
+struct Corpus {
+  const char *name;
+  glyphknit::FontDescriptor font_descriptor;
+  float font_size;
+  std::vector<std::string> paragraphs;
+};
+
+static const double kWidths[] = {60, 150, 400, 1000};
+
+static std::vector<Corpus> CreateCorpora(const BenchFonts &fonts) {
+  std::vector<Corpus> corpora;
+
+  corpora.push_back(Corpus{
+    .name = "latin",
+    .font_descriptor = fonts.serif,
+    .font_size = 13,
+    .paragraphs = {
+      "It is being written with interactive (editable) text as a goal, so laying out a paragraph has to be fast enough to be done again after each keystroke.",
+      "The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs! How vexingly quick daft zebras jump; sphinx of black quartz, judge my vow.",
+      "Typesetting is the composition of text by means of arranging physical types or their digital equivalents. Stored letters and other symbols are retrieved and ordered according to a language's orthography for visual display. Typesetting requires one or more fonts, which are widely but erroneously confused with and substituted for typefaces. One significant effect of typesetting was that authorship of works could be spotted more easily, making it difficult for copiers who have not gained permission.",
+      "Ça coûte 12,50 € — « déjà vu », naïve façade, Ærøskøbing, Größe, ﬁnance, office, ffl.",
+      "Short line.",
+    },
+  });
+
+  corpora.push_back(Corpus{
+    .name = "cjk",
+    .font_descriptor = fonts.sans_serif,
+    .font_size = 14,
+    .paragraphs = {
+      "吾輩は猫である。名前はまだ無い。どこで生れたかとんと見当がつかぬ。何でも薄暗いじめじめした所でニャーニャー泣いていた事だけは記憶している。",
+      "排版引擎需要处理许多不同的书写系统。中文文本通常没有空格，因此每个汉字之间都可以换行。",
+      "텍스트 레이아웃 엔진은 여러 문자 체계를 처리해야 합니다. 한국어는 단어 사이에 공백을 사용합니다.",
+      "Unicode 7.0では、日本語と English が混ざった文章（mixed text）もよく使われます。",
+    },
+  });
+
+  corpora.push_back(Corpus{
+    .name = "bidi",
+    .font_descriptor = fonts.sans_serif,
+    .font_size = 14,
+    .paragraphs = {
+      "مرحبا بكم في هذا الاختبار. هذا النص مكتوب باللغة العربية ويحتوي على بعض الكلمات الإنجليزية مثل Glyphknit و HarfBuzz وأرقام مثل 2014 و 3.14.",
+      "שלום עולם. זהו טקסט בעברית שמכיל גם מילים באנגלית כמו Unicode ו-OpenType, וגם מספרים כמו 1234.",
+      "The title of the book is \"كتاب الحيوان\" and it was written in the 9th century (see page 123).",
+      "שششششششש abc שششששש 123 def",
+    },
+  });
+
+  corpora.push_back(Corpus{
+    .name = "indic",
+    .font_descriptor = fonts.sans_serif,
+    .font_size = 14,
+    .paragraphs = {
+      "यह एक परीक्षण अनुच्छेद है। हिंदी देवनागरी लिपि में लिखी जाती है और इसमें संयुक्ताक्षर जैसे क्ष, त्र और ज्ञ होते हैं।",
+      "இது ஒரு சோதனை பத்தி. தமிழ் எழுத்துக்கள் பல கூட்டு வடிவங்களைக் கொண்டுள்ளன.",
+      "এটি একটি পরীক্ষামূলক অনুচ্ছেদ। বাংলা লিপিতে অনেক যুক্তাক্ষর আছে।",
+    },
+  });
+
+  corpora.push_back(Corpus{
+    .name = "urls",
+    .font_descriptor = fonts.monospace,
+    .font_size = 12,
+    .paragraphs = {
+      "https://www.example.com/a/very/long/path/that/does/not/have/any/space/in/it/index.html?query=typesetting&language=en&page=42#section-7",
+      "See http://www.unicode.org/Public/7.0.0/ucd/auxiliary/LineBreakTest.txt and http://www.microsoft.com/typography/otspec/os2.htm#fc for details.",
+      "aGVsbG8gd29ybGQgdGhpcyBpcyBhIGxvbmcgYmFzZTY0IHN0cmluZyB3aXRob3V0IGFueSBzcGFjZSBpbiBpdCBzbyBpdCBoYXMgdG8gYmUgY3V0IGJ5IGdyYXBoZW1lIGNsdXN0ZXI=",
+    },
+  });
+
+  Corpus labels{
+    .name = "labels",
+    .font_descriptor = fonts.sans_serif,
+    .font_size = 12,
+  };
+  static const char *kLabels[] = {
+    "OK", "Cancel", "File", "Edit", "View", "Help", "Save as…", "12:30", "€9.99", "3 items", "Settings", "Log out", "Ω", "—", "Next ›", "‹ Back",
+  };
+  for (int repetition = 0; repetition < 8; ++repetition) {
+    labels.paragraphs.insert(labels.paragraphs.end(), std::begin(kLabels), std::end(kLabels));
+  }
+  corpora.push_back(std::move(labels));
+
+  return corpora;
+}
+
+static size_t CountGlyphs(const glyphknit::TypesetLines &typeset_lines) {
+  size_t glyphs_count = 0;
+  for (const auto &line : typeset_lines) {
+    for (const auto &run : line.runs) {
+      glyphs_count += run.glyphs.size();
+    }
+  }
+  return glyphs_count;
+}
+
+void RunTypesetBenchmarks(const BenchOptions &options, const BenchFonts &fonts) {
+  auto corpora = CreateCorpora(fonts);
+
+  glyphknit::Typesetter typesetter;
+  glyphknit::ShapingCache shaping_cache{options.shaping_cache_budget};
+  if (options.shaping_cache_budget > 0) {
+    typesetter.set_shaping_cache(&shaping_cache);
+  }
+  PrintResultsHeader();
+  for (const auto &corpus : corpora) {
+    if (options.only_corpus != nullptr && std::strcmp(options.only_corpus, corpus.name) != 0) {
+      continue;
+    }
+
+    // a TextBlock per paragraph so that what is measured is only the layout
+    std::list<glyphknit::TextBlock> text_blocks;
+    for (const auto &paragraph : corpus.paragraphs) {
+      text_blocks.emplace_back(corpus.font_descriptor, corpus.font_size);
+      text_blocks.back().SetText(paragraph.c_str());
+    }
+
+    for (auto width : kWidths) {
+      LatencyRecorder latencies;
+      size_t glyphs_count = 0;
+      shaping_cache.Clear();
+      auto shaping_cache_hits_count = shaping_cache.hits_count();
+      auto shaping_cache_misses_count = shaping_cache.misses_count();
+
+      // first pass to warm up the caches
+      for (auto &text_block : text_blocks) {
+        typesetter.PositionGlyphs(text_block, width);
+      }
+
+      auto start_time = LatencyRecorder::Clock::now();
+      do {
+        for (auto &text_block : text_blocks) {
+          auto paragraph_start_time = LatencyRecorder::Clock::now();
+          auto typeset_lines = typesetter.PositionGlyphs(text_block, width);
+          latencies.Record(LatencyRecorder::Clock::now() - paragraph_start_time);
+          glyphs_count += CountGlyphs(typeset_lines);
+        }
+      } while (std::chrono::duration<double>(LatencyRecorder::Clock::now() - start_time).count() < options.min_seconds_per_case);
+
+      PrintResults(corpus.name, width, latencies, glyphs_count);
+      if (options.shaping_cache_budget > 0) {
+        std::printf("    shaping cache: %lld hits, %lld misses, %zu entries using %zu bytes\n",
+                    (long long)(shaping_cache.hits_count() - shaping_cache_hits_count), (long long)(shaping_cache.misses_count() - shaping_cache_misses_count), shaping_cache.entries_count(), shaping_cache.memory_used());
+      }
+
+      if (options.print_stats) {
+        glyphknit::TypesetStats stats;
+        typesetter.set_stats(&stats);
+        for (auto &text_block : text_blocks) {
+          typesetter.PositionGlyphs(text_block, width);
+        }
+        typesetter.set_stats(nullptr);
+        PrintStats(stats);
+      }
+    }
+  }
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#ifndef GLYPHKNIT_BENCH_H_
+#define GLYPHKNIT_BENCH_H_
+
+#include "font.hh"
+#include "shaping_cache.hh"
+#include "typeset_stats.hh"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+struct BenchOptions {
+  double min_seconds_per_case;
+  const char *only_corpus;  // nullptr to run all the corpora
+  bool print_stats;  // detail of where the time goes, gathered in a separate untimed pass
+  size_t shaping_cache_budget;  // in bytes, 0 to not use a shaping cache
+};
+
+struct BenchFonts {
+  glyphknit::FontDescriptor sans_serif;
+  glyphknit::FontDescriptor serif;
+  glyphknit::FontDescriptor monospace;
+};
+
+class LatencyRecorder {
+ public:
+  typedef std::chrono::steady_clock Clock;
+
+  void Record(Clock::duration duration) { durations_.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()); }
+  size_t count() const { return durations_.size(); }
+  double total_seconds() const;
+  double PercentileInMicroseconds(double percentile) const;
+
+ private:
+  std::vector<int64_t> durations_;  // in nanoseconds
+};
+
+void PrintResultsHeader();
+void PrintResults(const char *corpus_name, double width, const LatencyRecorder &, size_t glyphs_count);
+void PrintStats(const glyphknit::TypesetStats &);
+
+void RunTypesetBenchmarks(const BenchOptions &, const BenchFonts &);
+void RunLongParagraphBenchmarks(const BenchOptions &, const BenchFonts &);
+void RunResizeBenchmarks(const BenchOptions &, const BenchFonts &);
+void RunEditBenchmarks(const BenchOptions &, const BenchFonts &);
+void RunLineBreakBenchmarks(const BenchOptions &, const BenchFonts &);
+void RunConstructionBenchmarks(const BenchOptions &, const BenchFonts &);
+void RunOptimalLineBreakingBenchmarks(const BenchOptions &, const BenchFonts &);
+
+#endif  // GLYPHKNIT_BENCH_H_
@@ -25,12 +25,17 @@
 #ifndef GLYPHKNIT_FONT_H_
 #define GLYPHKNIT_FONT_H_
 
-#include "autorelease.hh"
 #include "language.hh"
 
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 #include <cmath>
+#ifdef __APPLE__
+#include "autorelease.hh"
 #include <CoreText/CoreText.h>
+#endif
 #include <ft2build.h>
 #include FT_FREETYPE_H
 
@@ -41,6 +46,8 @@
 
 namespace glyphknit {
 
+class FontFile;
+
 enum class FontFamilyClass {
   kUnknown,
   kSansSerif,
@@ -53,22 +60,39 @@ enum class FontFamilyClass {
 class FontDescriptor {
   // In fact FontDescriptor is a glorified shared_ptr to a class that does everything
   // It's mainly to make it easier to use: the type name is simpler and no need to unreference the pointer for example when comparing
+  // All the descriptors of a same font share the same data (FontManager interns them by PostScript name) so comparing is cheap
  public:
   FontDescriptor() : data_{nullptr} {}
-  bool operator ==(const FontDescriptor &) const;
+  bool operator ==(const FontDescriptor &compared_to) const { return data_ == compared_to.data_; }
   bool operator !=(const FontDescriptor &compared_to) const { return !(*this == compared_to); }
   bool is_valid() const { return data_.get() != nullptr; }
   FT_Face GetFTFace() const;
   hb_font_t *GetHBFont() const;
+  // the shape plans are cached (without any user feature) so they are only compiled once for each set of properties
+  hb_shape_plan_t *GetShapePlan(const hb_segment_properties_t &) const;
+  // advance of the glyph before any shaping (in font units), cached as getting it from FreeType is not cheap
+  hb_position_t GetNominalAdvance(hb_codepoint_t glyph) const;
+  // returns an invalid descriptor when there is no fallback font left to try
+  // the fallback fonts are only looked for once (for all the descriptors of the font) so calling it again is cheap
   FontDescriptor GetFallback(size_t index, Language);
+#ifdef __APPLE__
   AutoReleasedCFRef<CTFontRef> CreateNativeFont(float size) const;
+#endif
   FontFamilyClass font_family_class() const;
+  // true if the font has a glyph for that character (without taking into account any substitution)
+  bool CoversCharacter(UChar32 codepoint) const;
 
   // TODO: way to get variations (bold/thin, italic, ...)
  private:
   friend class FontManager;
   class Data;
-  FontDescriptor(AutoReleasedCFRef<CTFontDescriptorRef> &&);  // the font descriptor must have been normalized
+#ifdef __APPLE__
+  // the font descriptor must have been normalized
+  // the font file only has to be given if Core Text does not know where the font comes from (for fonts in memory)
+  FontDescriptor(AutoReleasedCFRef<CTFontDescriptorRef> &&, std::shared_ptr<FontFile> = nullptr);
+#else
+  FontDescriptor(std::shared_ptr<FontFile>, FT_Face);  // takes ownership of the face
+#endif
   std::shared_ptr<Data> data_;
 };
 
@@ -76,14 +100,41 @@ class FontManager {
  public:
   FT_Library ft_library() const { return ft_library_; }
   static FontDescriptor CreateDescriptorFromPostScriptName(const char *name);
+#ifdef __APPLE__
   static FontDescriptor CreateDescriptorFromNativeFont(CTFontRef);
-  //static FontDescriptor CreateDescriptorFromLocalFile(const char *path);
+#endif
+  // the file is mapped in memory only once, whatever the number of faces of the font collection used
+  // returns an invalid descriptor if there is no face at that index
+  // if a font with the same PostScript name is already known, that one is returned
+  static FontDescriptor CreateDescriptorFromLocalFile(const char *path, int face_index = 0);
+  // the data is not copied so it must stay valid as long as the font is used (fonts are never released)
+  // with Core Text only the first face can be used
+  static FontDescriptor CreateDescriptorFromMemory(const void *data, size_t length, int face_index = 0);
   static FontManager *instance();
 
  private:
+  friend class FontDescriptor::Data;
   FontManager();
   ~FontManager();
+  // returns the descriptor already known for the same font if there is one
+  FontDescriptor Intern(FontDescriptor);
+  // returns nullptr if the file cannot be read
+  std::shared_ptr<FontFile> MapFontFile(const char *path);
+#ifndef __APPLE__
+  FontDescriptor CreateDescriptorFromFontFile(std::shared_ptr<FontFile>, int face_index);
+#endif
+
   FT_Library ft_library_;
+  std::unordered_map<std::string, FontDescriptor> fonts_by_postscript_name_;
+  // incremented each time a new font is interned, so that the fallback chains know they might be outdated
+  size_t fonts_generation_;
+  // by path, so that all the faces of a file share the same mapping
+  std::unordered_map<std::string, std::weak_ptr<FontFile>> font_files_;
+#ifdef __APPLE__
+  // the name looked for is not always the PostScript name of the font found
+  // fonts that could not be found are also remembered (as invalid descriptors) as looking for them is slow
+  std::unordered_map<std::string, FontDescriptor> fonts_by_requested_name_;
+#endif
 };
 
 static const float kFontComparisonDelta = 0.015625f;
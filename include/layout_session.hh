@@ -0,0 +1,100 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#ifndef GLYPHKNIT_LAYOUT_SESSION_H_
+#define GLYPHKNIT_LAYOUT_SESSION_H_
+
+#include "typesetter.hh"
+
+#include <vector>
+
+namespace glyphknit {
+
+// Layout of a TextBlock that is being edited.
+// Each update only lays out again the paragraphs touched by the changes recorded by the text block since the previous update
+// (the session consumes them, so there should only be one session per text block), and keeps the lines of the other paragraphs.
+// The TextBlock and the Typesetter must outlive the session.
+class LayoutSession {
+ public:
+  struct Paragraph {
+    ssize_t start_index;
+    ssize_t end_index;  // before the paragraph separator
+    // the offsets in the shaping and the lines are the ones from when the paragraph was laid out (it might have moved since then)
+    ShapedParagraph shaped_paragraph;
+    ShapedParagraph::Lines lines;
+    TypesetLines typeset_lines;  // the glyph offsets are relative to start_index
+    // the text of the paragraph changed (the layout above, if any, is the one of the paragraph before the change,
+    // from which only the lines around the change are broken again)
+    bool needs_shaping;
+  };
+
+  // lines [start_line_index, start_line_index + old_lines_count) have been replaced by [start_line_index, start_line_index + new_lines_count)
+  struct ChangedLines {
+    size_t start_line_index;
+    size_t old_lines_count;
+    size_t new_lines_count;
+  };
+
+  LayoutSession(Typesetter &, TextBlock &);
+  LayoutSession(const LayoutSession &) = delete;
+  LayoutSession &operator=(const LayoutSession &) = delete;
+
+  // lays out again what changed since the previous update (everything on the first update or when the width or the line breaking
+  // of the typesetter changes, but then the paragraphs that did not change are not shaped again), the lines being broken like Typesetter::PositionGlyphs does
+  // (a change of the optimal line breaking parameters is only seen when set_optimal_line_breaking is given other parameters)
+  // (only with the greedy line breaking are just the lines around a change broken again, the others breaking the whole paragraph again).
+  // A paragraph that changed is still shaped again in full and compared with its previous shaping, so an edit costs time proportional
+  // to the length of its paragraph: only breaking the lines and positioning their glyphs are limited to the lines around the edit.
+  ChangedLines Update(double available_width);
+
+  const std::vector<Paragraph> &paragraphs() const { return paragraphs_; }
+  size_t lines_count() const { return lines_count_; }
+  // all the lines, with the glyph offsets in the whole text (like Typesetter::PositionGlyphs)
+  TypesetLines AllLines() const;
+
+ private:
+  struct ChangedParagraphs {
+    size_t first_paragraph_index;
+    size_t end_paragraph_index;
+    size_t old_lines_count;
+  };
+  ChangedParagraphs ApplyChange(const TextBlock::Change &);
+  // returns the lines of the paragraph that changed
+  ChangedLines LayOutParagraph(Paragraph &, bool break_all_lines);
+  TypesetLines PositionLines(const Paragraph &, const ShapedParagraph &, const ShapedParagraph::Lines &);
+
+  Typesetter &typesetter_;
+  TextBlock &text_block_;
+  std::vector<Paragraph> paragraphs_;  // in the order of the text
+  size_t lines_count_;
+  double available_width_;  // the one of the previous update
+  bool laid_out_;  // false before the first update
+  // the line breaking of the typesetter at the previous update
+  const ShapedParagraph::OptimalLineBreakingParameters *optimal_line_breaking_;
+  bool balanced_line_breaking_;
+};
+
+}
+
+#endif  // GLYPHKNIT_LAYOUT_SESSION_H_
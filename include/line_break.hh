@@ -0,0 +1,42 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#ifndef GLYPHKNIT_LINE_BREAK_H_
+#define GLYPHKNIT_LINE_BREAK_H_
+
+#include <cstdint>
+#include <sys/types.h>
+
+namespace glyphknit {
+
+// Finds all the line break opportunities of the text of a paragraph in one pass, following the Unicode Line Breaking Algorithm (UAX #14)
+// with the same tailorings as ICU's default line break rules (so without going through an ICU break iterator).
+// The bit of each code unit a line can be broken before is set in bits (that must have room for length+1 bits), including the start and end of the text.
+// Text with characters of complex context scripts (Thai, Lao, Khmer, Myanmar...) needs a dictionary to be broken in words, so it is not handled:
+// false is then returned and the bits already set must be ignored.
+bool FindLineBreakOpportunities(const uint16_t *text, ssize_t length, uint64_t *bits);
+
+}
+
+#endif  // GLYPHKNIT_LINE_BREAK_H_
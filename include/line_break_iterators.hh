@@ -0,0 +1,63 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#ifndef GLYPHKNIT_LINE_BREAK_ITERATORS_H_
+#define GLYPHKNIT_LINE_BREAK_ITERATORS_H_
+
+#include "language.hh"
+
+#include <unordered_map>
+#include <unicode/ubrk.h>
+
+namespace glyphknit {
+
+// The ICU line break iterators of the languages of the text.
+// Opening an iterator loads the rules (and dictionaries) of its locale, so an iterator is only opened once per language for the whole process,
+// and each LineBreakIterators (that must not be used by several threads at the same time) clones the ones it needs from them.
+class LineBreakIterators {
+ public:
+  LineBreakIterators() {}
+  ~LineBreakIterators();
+  LineBreakIterators(const LineBreakIterators &) = delete;
+  LineBreakIterators &operator =(const LineBreakIterators &) = delete;
+
+  // if ICU has line break rules of its own for the language (for example Japanese, that allows breaks before small kana),
+  // so that its iterator has to be used instead of FindLineBreakOpportunities
+  bool IsTailored(Language);
+  // the line break iterator of the language (the text set to it is the one of its last use)
+  UBreakIterator *Get(Language);
+
+ private:
+  struct LanguageIterator {
+    UBreakIterator *iterator;  // nullptr until first needed
+    bool is_tailored;
+  };
+  LanguageIterator &Find(Language);
+
+  std::unordered_map<Tag, LanguageIterator> iterators_;  // by language code
+};
+
+}
+
+#endif  // GLYPHKNIT_LINE_BREAK_ITERATORS_H_
@@ -0,0 +1,74 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#ifndef GLYPHKNIT_PARAGRAPH_BOUNDARIES_H_
+#define GLYPHKNIT_PARAGRAPH_BOUNDARIES_H_
+
+#include <cstdint>
+#include <vector>
+#include <sys/types.h>
+#include <unicode/ubrk.h>
+
+namespace glyphknit {
+
+// Where grapheme clusters start, where lines can be broken and which characters are whitespace in the text of a paragraph,
+// found once for the whole paragraph by going forward through it and kept as bitmaps (one bit per UTF-16 code unit),
+// so that each query while shaping the paragraph is a bit test instead of a call to an ICU break iterator.
+// The indexes are relative to the start of the paragraph, and boundaries can be at the end of the text.
+class ParagraphBoundaries {
+ public:
+  ParagraphBoundaries() : length_{0} {}
+  // returns false when the text needs a dictionary to find where lines can be broken (Thai, Lao, Khmer, Myanmar...):
+  // only the line break opportunity at the end of the text is then set, the others having to be found with FindLineBreakOpportunitiesWithIterator
+  bool Find(const uint16_t *text, ssize_t length);
+  // replaces the line break opportunities before the code units in [start_index, end_index) by the ones of the line break iterator
+  // (for text that needs a dictionary, or a part of the text in a language with line break rules of its own), the whole text being given to the iterator for the context
+  void FindLineBreakOpportunitiesWithIterator(const uint16_t *text, ssize_t start_index, ssize_t end_index, UBreakIterator *line_break_iterator);
+
+  ssize_t length() const { return length_; }
+  bool IsGraphemeClusterBoundary(ssize_t index) const { return IsSet(grapheme_cluster_boundaries_, index); }
+  // line break opportunities not at a grapheme cluster boundary (for example between a space and a combining mark) are ignored
+  bool IsLineBreakOpportunity(ssize_t index) const { return IsSet(line_break_opportunities_, index); }
+  // the whitespace that can hang at the end of a line (not including no-break spaces, that must be handled as non-spacing characters at the end of a line)
+  bool IsWhitespace(ssize_t index) const { return IsSet(whitespaces_, index); }
+  // the first grapheme cluster boundary after the index
+  ssize_t NextGraphemeClusterBoundary(ssize_t index) const;
+
+ private:
+  typedef uint64_t Word;
+  static const int kWordBits = 64;
+
+  static bool IsSet(const std::vector<Word> &bits, ssize_t index) { return (bits[size_t(index) / kWordBits] >> (size_t(index) % kWordBits)) & 1; }
+  static void Set(std::vector<Word> &bits, ssize_t index) { bits[size_t(index) / kWordBits] |= Word(1) << (size_t(index) % kWordBits); }
+  static void Clear(std::vector<Word> &bits, ssize_t index) { bits[size_t(index) / kWordBits] &= ~(Word(1) << (size_t(index) % kWordBits)); }
+
+  ssize_t length_;
+  std::vector<Word> grapheme_cluster_boundaries_;
+  std::vector<Word> line_break_opportunities_;
+  std::vector<Word> whitespaces_;
+};
+
+}
+
+#endif  // GLYPHKNIT_PARAGRAPH_BOUNDARIES_H_
@@ -27,6 +27,7 @@
 
 #include <unicode/uscript.h>
 #include <cstring>
+#include <sys/types.h>
 
 namespace glyphknit {
 
@@ -0,0 +1,179 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#ifndef GLYPHKNIT_SHAPED_PARAGRAPH_H_
+#define GLYPHKNIT_SHAPED_PARAGRAPH_H_
+
+#include "font.hh"
+#include "language.hh"
+
+#include <functional>
+#include <vector>
+#include <unicode/ubidi.h>
+#include <unicode/uscript.h>
+
+namespace glyphknit {
+
+// Result of the first stage of the typesetting of a paragraph: its text split in runs, each shaped once,
+// and for each cluster what is needed to break lines (advance, break opportunities, if it is safe to break before it...)
+// It does not depend on the available width, so breaking it again at another width does not need any shaping.
+class ShapedParagraph {
+ public:
+  struct Glyph {
+    uint16_t id;
+    uint32_t cluster;  // offset in the text of the start of the glyph cluster
+    // in font units
+    hb_position_t x_advance;
+    hb_position_t y_advance;
+    hb_position_t x_offset;
+    hb_position_t y_offset;
+  };
+
+  struct Run {
+    ssize_t start_index;
+    ssize_t end_index;
+    FontDescriptor font_descriptor;
+    float font_size;
+    Tag opentype_language_tag;
+    UScriptCode script;
+    UBiDiDirection bidi_direction;
+    int32_t bidi_visual_index;
+    bool end_of_line;  // a line separator follows the run
+    std::vector<Glyph> glyphs;  // in visual order (as returned by HarfBuzz)
+    size_t first_cluster_index;  // in clusters()
+  };
+
+  enum ClusterFlags : uint8_t {
+    kLineBreakOpportunity = 1 << 0,  // a line can start at this cluster
+    kSafeToBreak = 1 << 1,  // cutting the shaping of the run before this cluster gives the same result as shaping the parts separately
+    kHangingWhitespace = 1 << 2,  // its width is ignored at the end of a line
+  };
+
+  // a glyph cluster, or a grapheme cluster when a glyph cluster (for example a ligature) is made of multiple ones,
+  // in which case the first one gets its glyphs and the advance is shared between them
+  // (glyph clusters ending inside a grapheme cluster are merged first, so a cluster always starts at a grapheme cluster boundary)
+  struct Cluster {
+    ssize_t start_index;
+    uint32_t run_index;
+    uint32_t glyph_index;  // in the glyphs of the run
+    uint32_t glyphs_count;
+    uint8_t flags;
+    double advance;  // in pixels
+
+    bool has_flag(ClusterFlags flag) const { return (flags & flag) != 0; }
+  };
+
+  struct Line {
+    ssize_t start_index;
+    ssize_t end_index;
+    size_t first_run_index;
+    size_t end_run_index;
+    double width;  // including the whitespace at the end of the line
+    bool emergency_break;  // no line break opportunity fitted so the line had to be cut between grapheme clusters
+  };
+  typedef std::vector<Line> Lines;
+
+  ssize_t start_index() const { return start_index_; }
+  ssize_t end_index() const { return end_index_; }
+  const std::vector<Run> &runs() const { return runs_; }
+  const std::vector<Cluster> &clusters() const { return clusters_; }
+  size_t clusters_end_index(size_t run_index) const { return run_index + 1 < runs_.size() ? runs_[run_index + 1].first_cluster_index : clusters_.size(); }
+  // index of the cluster starting at the text index, or of the end of the clusters of the run if it is the end of the run
+  size_t FindCluster(size_t run_index, ssize_t text_index) const;
+
+  // moves all the offsets so that the paragraph starts at start_index (for when text was inserted or removed before the paragraph)
+  void MoveTo(ssize_t start_index);
+
+  // greedy line breaking (only uses the clusters, no shaping)
+  Lines BreakLines(double available_width) const;
+  // the available width can also be different for each line (for example when text flows around a shape),
+  // in which case it is asked at the start of each line, the first line of the paragraph having the index first_line_index
+  typedef std::function<double(size_t line_index)> LineWidthCallback;
+  Lines BreakLines(const LineWidthCallback &, size_t first_line_index = 0) const;
+
+  // Total-fit (Knuth-Plass) line breaking for ragged text: the breaks are chosen to minimize the sum of the demerits of all the lines of the paragraph,
+  // a line having more demerits the more its unused width is big compared to the stretch.
+  // The defaults are the ones TeX uses (\tolerance, \linepenalty, \adjdemerits) with a stretch of a fifth of the available width.
+  struct OptimalLineBreakingParameters {
+    // unused width giving a badness of 100 (the badness being 100 * (unused width / stretch)^3, at most 10000), as a fraction of the available width
+    double stretch;
+    // lines with a higher badness are only used if the paragraph cannot be broken without them (the last line of a paragraph having no badness)
+    double tolerance;
+    double line_penalty;  // added to the badness of each line, so that fewer lines are preferred
+    double adjacent_fitness_demerits;  // for a line much looser than the one before or after it
+    double emergency_break_penalty;  // for cutting a word too wide for a line between grapheme clusters
+    // number of possible breaks the lines are looked for from, the ones with most demerits being dropped when there are more
+    size_t max_active_breaks;
+
+    OptimalLineBreakingParameters() : stretch(0.2), tolerance(200), line_penalty(10), adjacent_fitness_demerits(10000), emergency_break_penalty(100), max_active_breaks(32) {}
+  };
+  Lines BreakLinesOptimally(double available_width, const OptimalLineBreakingParameters &) const;
+
+  // the width of the widest part of the paragraph that cannot be broken (min-content),
+  // and of the widest line when lines are only broken at line separators (max-content), whitespace at the end of lines not counted
+  struct IntrinsicWidths {
+    double min_content;
+    double max_content;
+  };
+  IntrinsicWidths FindIntrinsicWidths() const;
+
+  // greedy line breaking at the smallest width giving as many lines as at the available width, so that the lines have similar widths (for headlines or captions)
+  Lines BreakLinesBalanced(double available_width) const;
+
+  // Breaking again in lines a paragraph after its text was edited, knowing the lines the previous shaping of the paragraph was broken in
+  // at the same available width (the previous shaping and lines must have been moved to start at the same index as this paragraph).
+  // The lines before the one preceding the first difference between the two shapings are kept,
+  // and the lines are then broken again until one starts at the same place as one of the previous lines in the part of the paragraph that did not change,
+  // the following lines being the previous ones moved.
+  struct Reflow {
+    size_t first_line_index;  // the lines before it are the same as the previous ones
+    size_t end_line_index;  // the lines [first_line_index, end_line_index) are new
+    size_t previous_end_line_index;  // the lines from end_line_index are the previous lines from previous_end_line_index, moved
+    // what the previous lines from previous_end_line_index were moved by
+    ssize_t index_delta;
+    ssize_t run_index_delta;
+    int32_t bidi_visual_index_delta;
+  };
+  // When given, confirm_line is called for each line broken again, and returns true if the line had to end earlier
+  // (for example because of a ligature it cuts), the lines after it then being broken again too.
+  typedef std::function<bool(Line &, size_t *next_line_first_run_index)> LineConfirmationCallback;
+  Lines BreakLinesAgain(double available_width, const ShapedParagraph &previous, const Lines &previous_lines, Reflow *, const LineConfirmationCallback &confirm_line = nullptr) const;
+
+ private:
+  friend class Typesetter;
+
+  // greedy line breaking of the lines from the one starting at line_start_index (its first run being first_run_index) to the end of the paragraph,
+  // or until stop_before_line returns true for the start of the next line (returning true in that case)
+  typedef std::function<bool(ssize_t line_start_index, size_t first_run_index)> LineStartCallback;
+  bool BreakLinesFrom(Lines &, const LineWidthCallback &, size_t line_index, ssize_t line_start_index, size_t first_run_index, const LineStartCallback &stop_before_line) const;
+
+  ssize_t start_index_;
+  ssize_t end_index_;
+  std::vector<Run> runs_;
+  std::vector<Cluster> clusters_;  // in logical order
+};
+
+}
+
+#endif  // GLYPHKNIT_SHAPED_PARAGRAPH_H_
@@ -0,0 +1,106 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#ifndef GLYPHKNIT_SHAPING_CACHE_H_
+#define GLYPHKNIT_SHAPING_CACHE_H_
+
+#include "font.hh"
+
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace glyphknit {
+
+// Least recently used cache of the shaping of short segments of text (for example a word and the space following it).
+// Everything is kept in font units so the same results can be used for any font size.
+// It can be shared by multiple Typesetters (but not used from multiple threads at the same time).
+class ShapingCache {
+ public:
+  struct Glyph {
+    uint16_t id;
+    uint32_t cluster_delta;  // offset of the cluster from the start of the segment
+    hb_position_t x_advance;
+    hb_position_t y_advance;
+    hb_position_t x_offset;
+    hb_position_t y_offset;
+  };
+  typedef std::vector<Glyph> Glyphs;
+
+  // longer segments are not worth caching as they are unlikely to be seen again
+  static const size_t kMaxSegmentLength = 64;
+  static const size_t kDefaultMemoryBudget = 4 * 1024 * 1024;  // in bytes
+
+  explicit ShapingCache(size_t memory_budget = kDefaultMemoryBudget);
+  ShapingCache(const ShapingCache &) = delete;
+  ShapingCache &operator=(const ShapingCache &) = delete;
+
+  // returns nullptr if the segment is not in the cache
+  // the result is only valid until the next call to Add
+  const Glyphs *Find(FontDescriptor, const hb_segment_properties_t &, const uint16_t *text, size_t length);
+  void Add(FontDescriptor, const hb_segment_properties_t &, const uint16_t *text, size_t length, Glyphs &&);
+  void Clear();
+
+  size_t memory_budget() const { return memory_budget_; }
+  void set_memory_budget(size_t memory_budget);
+  size_t memory_used() const { return memory_used_; }
+  size_t entries_count() const { return entries_.size(); }
+  int64_t hits_count() const { return hits_count_; }
+  int64_t misses_count() const { return misses_count_; }
+
+ private:
+  struct Key {
+    hb_font_t *hb_font;
+    hb_segment_properties_t segment_properties;
+    std::vector<uint16_t> text;
+  };
+  struct KeyHash {
+    size_t operator()(const Key *) const;
+  };
+  struct KeyEqual {
+    bool operator()(const Key *, const Key *) const;
+  };
+  struct Entry {
+    Key key;
+    FontDescriptor font_descriptor;  // so that the font stays alive as long as it is used in a key
+    Glyphs glyphs;
+    size_t memory_used;
+  };
+  typedef std::list<Entry> Entries;
+
+  void SetLookupKey(FontDescriptor, const hb_segment_properties_t &, const uint16_t *text, size_t length);
+  void EvictUntilUnderBudget();
+
+  size_t memory_budget_;
+  size_t memory_used_;
+  int64_t hits_count_;
+  int64_t misses_count_;
+  Entries entries_;  // the most recently used first
+  std::unordered_map<const Key *, Entries::iterator, KeyHash, KeyEqual> entries_by_key_;
+  Key lookup_key_;  // reused to not have to allocate memory at each lookup
+};
+
+}
+
+#endif  // GLYPHKNIT_SHAPING_CACHE_H_
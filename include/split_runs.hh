@@ -27,6 +27,9 @@
 
 #include "language.hh"
 #include "text_block.hh"
+
+#include <list>
+#include <vector>
 #include <unicode/ubidi.h>
 
 namespace glyphknit {
@@ -46,10 +49,32 @@ struct TextRun {
 
 typedef std::list<TextRun> ListOfRuns;
 
-void SplitRunsByLanguage(ListOfRuns &runs, const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index);
-void SplitRunsInLines(ListOfRuns &runs, const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index);
+struct BidiVisualRun {
+  UBiDiDirection direction;
+  int32_t visual_index, logical_start, length;
+};
+
+// The memory used to split paragraphs in runs, kept from one paragraph to the next
+// so that nothing has to be allocated once a paragraph with as many runs has been split.
+struct SplitRunsStorage {
+  SplitRunsStorage() : bidi(nullptr) {}
+  ~SplitRunsStorage();
+  SplitRunsStorage(const SplitRunsStorage &) = delete;
+  SplitRunsStorage &operator=(const SplitRunsStorage &) = delete;
+
+  ListOfRuns spare_runs;  // the list nodes of the runs thrown away, used for the new runs
+  UBiDi *bidi;  // only opened when first needed
+  std::vector<BidiVisualRun> bidi_runs;
+};
+
+// when spare runs are given, the new runs are taken from them and the runs thrown away added to them
+void SplitRunsByLanguage(ListOfRuns &runs, const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index, ListOfRuns *spare_runs = nullptr);
+void SplitRunsInLines(ListOfRuns &runs, const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index, ListOfRuns *spare_runs = nullptr);
 ListOfRuns CreateBaseListOfRunsForParagraph(ssize_t paragraph_start_index, ssize_t paragraph_end_index);
 ListOfRuns SplitRuns(const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index);
+// same, but the runs given (the ones of the previous paragraph) are replaced, reusing their memory and the one of the storage;
+// the paragraph level has to be given when only the start of a paragraph is split, as its direction might come from the text after
+void SplitRuns(ListOfRuns &runs, SplitRunsStorage &, const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index, UBiDiLevel paragraph_level = UBIDI_DEFAULT_LTR);
 
 }
 
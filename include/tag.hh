@@ -25,6 +25,7 @@
 #ifndef GLYPHKNIT_TAG_H_
 #define GLYPHKNIT_TAG_H_
 
+#include <cstdint>
 #include <cstring>
 #include <cstdlib>
 
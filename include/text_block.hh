@@ -73,6 +73,9 @@ class TextBlock {
   void SetText(const uint16_t *, size_t length);
   void SetText(const char *, size_t length);
   void SetText(const char *);
+  // replaces the text in [start, end) (the text inserted gets the attributes of the character before it)
+  void ReplaceText(ssize_t start, ssize_t end, const uint16_t *, size_t length);
+  void ReplaceText(ssize_t start, ssize_t end, const char *);
 
   const uint16_t *text_content() const { return text_.data(); }
   ssize_t text_length() const { return text_.size(); }
@@ -82,14 +85,31 @@ class TextBlock {
   void SetFontFace(FontDescriptor font_descriptor, ssize_t start = 0, ssize_t end = -1);
   void SetLanguage(Language language, ssize_t start = 0, ssize_t end = -1);
 
+  // Changes of the text or attributes are recorded until ClearChanges() is called,
+  // so that a layout of the text block can be updated by only laying out again what was changed.
+  // For each change, what was in [start, old_end) is now in [start, new_end) (old_end == new_end for a change of attributes).
+  struct Change {
+    ssize_t start;
+    ssize_t old_end;
+    ssize_t new_end;
+
+    // the single change equivalent to this one followed by the one given (whose offsets are in the text after this one)
+    Change FollowedBy(const Change &) const;
+  };
+  // (when many changes have been recorded they are merged together, so the list stays short but the changes can cover more text than was really changed)
+  const std::vector<Change> &changes() const { return changes_; }
+  void ClearChanges() { changes_.clear(); }
+
  private:
   void MergeAdjacentRunsWithSameAttributes();
+  void RecordChange(const Change &);
 
   template <typename T, typename Comparator>
   void SetAttribute(T AllTextAttributes::*attribute, const T &value, Comparator f, ssize_t start, ssize_t end);
 
   std::vector<uint16_t> text_;
   std::list<TextAttributesRun> attributes_runs_;
+  std::vector<Change> changes_;
 };
 
 }
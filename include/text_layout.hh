@@ -0,0 +1,64 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#ifndef GLYPHKNIT_TEXT_LAYOUT_H_
+#define GLYPHKNIT_TEXT_LAYOUT_H_
+
+#include "typesetter.hh"
+
+#include <vector>
+
+namespace glyphknit {
+
+// Layout of a TextBlock kept to be able to lay it out again at other widths (when a window is resized for example).
+// The text is itemized and shaped once when the layout is created, after that only the line breaking
+// and the positioning of the glyphs are done again (plus the shaping of the text around breaks that are not safe).
+// The TextBlock and the Typesetter must outlive the layout, and the layout must be created again if the text block changes.
+class TextLayout {
+ public:
+  typedef ShapedParagraph::LineWidthCallback LineWidthCallback;
+
+  TextLayout(Typesetter &, const TextBlock &);
+  TextLayout(const TextLayout &) = delete;
+  TextLayout &operator=(const TextLayout &) = delete;
+
+  // the lines are broken like Typesetter::PositionGlyphs does
+  TypesetLines PositionGlyphs(double available_width);
+  // the available width of each line is asked at the start of the line (its index is the one in the whole text block),
+  // the lines then always being broken greedily (the optimal and balanced line breakings set on the typesetter are not used)
+  TypesetLines PositionGlyphs(const LineWidthCallback &);
+  // the last width is used for all the lines after it (there must be at least one width)
+  TypesetLines PositionGlyphs(const std::vector<double> &line_widths);
+
+  const std::vector<ShapedParagraph> &paragraphs() const { return paragraphs_; }
+
+ private:
+  Typesetter &typesetter_;
+  const TextBlock &text_block_;
+  std::vector<ShapedParagraph> paragraphs_;
+};
+
+}
+
+#endif  // GLYPHKNIT_TEXT_LAYOUT_H_
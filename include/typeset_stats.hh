@@ -0,0 +1,73 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#ifndef GLYPHKNIT_TYPESET_STATS_H_
+#define GLYPHKNIT_TYPESET_STATS_H_
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace glyphknit {
+
+// Statistics about where the time goes when typesetting.
+// They are only gathered when a TypesetStats has been given to the Typesetter,
+// and accumulate until Reset() is called.
+struct TypesetStats {
+  enum Phase {
+    kFindBoundaries,  // grapheme clusters and line break opportunities
+    kSplitRuns,
+    kFontFallback,  // giving to each grapheme cluster the first font of the fallback chain that has glyphs for it
+    kShape,
+    kAnalyzeClusters,  // finding the advance, break opportunities and safe breaks of each cluster
+    kBreakLines,
+    kOutput,  // converting the glyphs of each line to pixels
+    kCleanup,  // reordering and merging of the runs of each line
+    kPhasesCount,
+  };
+  static const char *PhaseName(Phase);
+
+  int64_t phase_nanoseconds[kPhasesCount];
+
+  int64_t paragraphs_count;
+  int64_t shape_calls_count;
+  int64_t max_shape_calls_per_paragraph;
+  // shaping again the part of a run on a line because a break around it was not safe
+  int64_t line_break_reshapes_count;
+  // line breaks where the glyphs on both sides did not interact so the shaping of the run could just be split
+  int64_t safe_line_breaks_count;
+  // no line break opportunity fitting on the line so it had to be cut between grapheme clusters
+  int64_t grapheme_cluster_breaks_count;
+  // number of grapheme clusters a font was missing glyphs for so the next fallback font had to be tried (by PostScript name)
+  std::map<std::string, int64_t> fallback_retries_per_font;
+
+  TypesetStats() { Reset(); }
+  void Reset();
+  int64_t total_nanoseconds() const;
+  double shape_calls_per_paragraph() const { return paragraphs_count == 0 ? 0 : double(shape_calls_count) / double(paragraphs_count); }
+};
+
+}
+
+#endif  // GLYPHKNIT_TYPESET_STATS_H_
@@ -26,7 +26,15 @@
 #define GLYPHKNIT_TYPESETTER_H_
 
 #include "text_block.hh"
+#include "line_break_iterators.hh"
+#include "paragraph_boundaries.hh"
+#include "shaped_paragraph.hh"
+#include "shaping_cache.hh"
+#include "split_runs.hh"
+#include "typeset_stats.hh"
 
+#include <limits>
+#include <unordered_map>
 #include <vector>
 #include <unicode/ubrk.h>
 #include <unicode/ubidi.h>
@@ -34,15 +42,20 @@
 namespace glyphknit {
 
 typedef uint16_t GlyphId;
+#ifdef __APPLE__
+typedef CGFloat Coordinate;
 typedef CGPoint GlyphPosition;
+#else
+typedef double Coordinate;
+#endif
 typedef ssize_t TextOffset;
 struct TypesetRun {
   struct Glyph {
     GlyphId id;
-    CGFloat x_offset;
-    CGFloat y_offset;
-    CGFloat x_advance;
-    CGFloat y_advance;
+    Coordinate x_offset;
+    Coordinate y_offset;
+    Coordinate x_advance;
+    Coordinate y_advance;
     TextOffset offset;
   };
 
@@ -56,32 +69,123 @@ struct TypesetRun {
 };
 struct TypesetLine {
   std::vector<TypesetRun> runs;
-  CGFloat ascent;
-  CGFloat descent;
-  CGFloat leading;
+  Coordinate ascent;
+  Coordinate descent;
+  Coordinate leading;
 
-  CGFloat height() { return ascent + descent + leading; }
+  Coordinate height() { return ascent + descent + leading; }
 };
 typedef std::vector<TypesetLine> TypesetLines;
 
+// what Typesetter::Measure gives: the size of the lines, without their glyphs
+struct LineMetrics {
+  Coordinate ascent;
+  Coordinate descent;
+  Coordinate leading;
+  Coordinate width;  // without the whitespace at the end of the line
+
+  Coordinate height() const { return ascent + descent + leading; }
+};
+struct TextMetrics {
+  std::vector<LineMetrics> lines;
+  Coordinate width;  // of the widest line
+  Coordinate height;  // of all the lines
+
+  size_t lines_count() const { return lines.size(); }
+};
+
+// what PositionGlyphs can lay out at most (no limit by default)
+struct LayoutLimits {
+  size_t max_lines;
+  Coordinate max_height;  // of all the lines
+  bool ellipsis;  // when the text is truncated, its last line is cut at a grapheme cluster boundary if needed to be ended by an ellipsis
+
+  LayoutLimits() : max_lines(std::numeric_limits<size_t>::max()), max_height(std::numeric_limits<Coordinate>::infinity()), ellipsis(false) {}
+};
+
 class Typesetter {
  public:
   Typesetter();
   ~Typesetter();
   TypesetLines PositionGlyphs(TextBlock &, double available_width);
+  // stops as soon as a limit is reached, truncated being set to true if some text was not laid out
+  // (with the greedy line breaking, only the start of a long paragraph is shaped, so the cost only depends on the lines laid out)
+  TypesetLines PositionGlyphs(TextBlock &, double available_width, const LayoutLimits &, bool *truncated);
+  // the lines PositionGlyphs would give, but only their size (nothing is output, and the memory used is kept for the next calls)
+  TextMetrics Measure(TextBlock &, double available_width);
+  // same, reusing the memory of the metrics given so that no memory is allocated when measuring again texts of similar size
+  void Measure(TextBlock &, double available_width, TextMetrics *);
+  // the widths the text needs at least to not have to cut words (min-content) and to not have to break lines (max-content), without laying out any line
+  ShapedParagraph::IntrinsicWidths MeasureIntrinsicWidths(TextBlock &);
+#ifdef __APPLE__
   void DrawToContext(TextBlock &, size_t available_width, CGContextRef);
+#endif
+  // statistics are only gathered when a sink is set (nullptr by default)
+  void set_stats(TypesetStats *stats) { stats_ = stats; }
+  // when a cache is set, words are shaped separately so that their shaping can be reused (nullptr by default)
+  void set_shaping_cache(ShapingCache *shaping_cache) { shaping_cache_ = shaping_cache; }
+  // when parameters are set, the lines are broken with ShapedParagraph::BreakLinesOptimally instead of greedily (nullptr by default)
+  void set_optimal_line_breaking(const ShapedParagraph::OptimalLineBreakingParameters *parameters) { optimal_line_breaking_ = parameters; }
+  const ShapedParagraph::OptimalLineBreakingParameters *optimal_line_breaking() const { return optimal_line_breaking_; }
+  // when true, the lines are broken with ShapedParagraph::BreakLinesBalanced instead (false by default, used even if optimal line breaking parameters are set)
+  void set_balanced_line_breaking(bool balanced) { balanced_line_breaking_ = balanced; }
+  bool balanced_line_breaking() const { return balanced_line_breaking_; }
+  bool breaks_lines_greedily() const { return optimal_line_breaking_ == nullptr && !balanced_line_breaking_; }
+
+  // the two stages of PositionGlyphs, for when the same paragraph has to be broken in lines differently:
+  // - shaping a paragraph (the paragraph must not contain any paragraph separator)
+  ShapedParagraph ShapeParagraph(const TextBlock &, ssize_t paragraph_start_index, ssize_t paragraph_end_index);
+  // - breaking it in lines like PositionGlyphs does (with the line breaking chosen, the lines cut inside a ligature being shaped to check they fit)
+  ShapedParagraph::Lines BreakLines(const TextBlock &, const ShapedParagraph &, double available_width);
+  //   with a different width for each line the lines are always broken greedily, the optimal and balanced line breakings needing the same width for all the lines
+  ShapedParagraph::Lines BreakLines(const TextBlock &, const ShapedParagraph &, const ShapedParagraph::LineWidthCallback &, size_t first_line_index);
+  //   or breaking again greedily only the lines around an edit (see ShapedParagraph::BreakLinesAgain)
+  ShapedParagraph::Lines BreakLinesAgain(const TextBlock &, const ShapedParagraph &, double available_width, const ShapedParagraph &previous, const ShapedParagraph::Lines &previous_lines, ShapedParagraph::Reflow *);
+  // - positioning the glyphs of the lines found (only the text around breaks that are not safe is shaped again)
+  TypesetLines PositionLines(const TextBlock &, const ShapedParagraph &, const ShapedParagraph::Lines &);
 
  private:
-  UBreakIterator *line_break_iterator_;
-  UBreakIterator *grapheme_cluster_iterator_;
+  LineBreakIterators line_break_iterators_;
+  ParagraphBoundaries boundaries_;  // the ones of the paragraph being shaped
+
+  struct ShapedSegment {
+    ssize_t start_index;
+    size_t first_glyph_index;  // in shaped_glyphs_
+    size_t glyphs_count;
+  };
+
   hb_buffer_t *hb_buffer_;
+  hb_buffer_t *segment_hb_buffer_;  // only created when a shaping cache is used
+  TypesetStats *stats_;
+  ShapingCache *shaping_cache_;
+  const ShapedParagraph::OptimalLineBreakingParameters *optimal_line_breaking_;
+  bool balanced_line_breaking_;
+  std::vector<ShapedSegment> shaped_segments_;
+  ShapingCache::Glyphs shaped_glyphs_;
+  ShapingCache::Glyphs new_cache_glyphs_;
+  ShapingCache::Glyphs uncached_glyphs_;
+  std::vector<ShapedParagraph::Glyph> reshaped_glyphs_;
+  std::unordered_map<Tag, hb_language_t> harfbuzz_languages_;  // by OpenType language tag
+  // reused from one paragraph to the next so that once big enough measuring allocates nothing
+  SplitRunsStorage split_runs_storage_;
+  ListOfRuns split_runs_;
+  std::vector<std::vector<ShapedParagraph::Glyph>> spare_glyphs_;
+  ShapedParagraph measured_paragraph_;
+  ShapedParagraph::Lines measured_lines_;
 
+  hb_language_t GetHarfBuzzLanguage(Tag opentype_language_tag);
   void Shape(const TextBlock &, ssize_t start_index, ssize_t end_index, FontDescriptor, Tag opentype_language_tag, UScriptCode, UBiDiDirection);
-  ssize_t CountGlyphsThatFit(const TextBlock &, ssize_t width, bool start_of_line);
-  ssize_t FindTextOffsetAfterGlyphCluster(ssize_t glyph_index, ssize_t paragraph_end_index);
+  void ShapeWithCache(const TextBlock &, ssize_t start_index, ssize_t end_index, FontDescriptor);
+  void AddClusters(ShapedParagraph &, size_t run_index, const TextBlock &);
+  void ShapeParagraph(ShapedParagraph &, const TextBlock &, ssize_t paragraph_start_index, ssize_t paragraph_end_index, UBiDiLevel paragraph_level = UBIDI_DEFAULT_LTR);
+  // if the line has to end one cluster earlier as it does not fit once the ligature it is cut inside is shaped again
+  bool ConfirmEmergencyBreak(const TextBlock &, const ShapedParagraph &, const ShapedParagraph::LineWidthCallback &, size_t line_index, ShapedParagraph::Line &, size_t *next_line_first_run_index);
+  void ConfirmEmergencyBreaks(const TextBlock &, const ShapedParagraph &, const ShapedParagraph::LineWidthCallback &, size_t first_line_index, ShapedParagraph::Lines &);
+  void BreakLines(const TextBlock &, const ShapedParagraph &, double available_width, ShapedParagraph::Lines &);
   TypesetLines TypesetParagraph(const TextBlock &, ssize_t paragraph_start_index, ssize_t paragraph_end_index, double available_width);
-  void OutputShape(TypesetLines &, double &current_text_width, FontDescriptor, float font_size, UBiDiDirection, int bidi_visual_index, int bidi_visual_subindex);
-  ssize_t PreviousBreak(ssize_t index, ssize_t paragraph_start_index);
+  void OutputRunPart(TypesetLine &, const TextBlock &, const ShapedParagraph &, size_t run_index, ssize_t start_index, ssize_t end_index, int bidi_visual_subindex);
+  void OutputShape(TypesetLine &, const ShapedParagraph::Run &, int bidi_visual_subindex, const ShapedParagraph::Glyph *glyphs, size_t glyphs_count);
+  void ReplaceWithEllipsizedLine(TypesetLine &, const TextBlock &, const ShapedParagraph &, const ShapedParagraph::Line &, double available_width);
 };
 
 }
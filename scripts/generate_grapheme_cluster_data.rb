@@ -0,0 +1,161 @@
+#!/usr/bin/ruby
+
+# Copyright © 2014  Vincent Isambart
+#
+#  This file is part of Glyphknit.
+#
+# Permission is hereby granted, without written agreement and without
+# license or royalty fees, to use, copy, modify, and distribute this
+# software and its documentation for any purpose, provided that the
+# above copyright notice and the following two paragraphs appear in
+# all copies of this software.
+#
+# IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+# DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+# ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+# IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+# DAMAGE.
+#
+# THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+# BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+# FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+# ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+# PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+
+# Generates the tables used by src/grapheme_cluster.cc to find the boundaries of extended grapheme clusters
+# following the Unicode Text Segmentation rules (UAX #29).
+#
+# To give the same results as ICU's character break iterators, the data must be the one
+# of the Unicode version used by the ICU glyphknit is compared with (Unicode 15.0 for ICU 72),
+# so the path to the UCD directory of that version has to be given.
+# Are needed (with the same layout as on unicode.org): auxiliary/GraphemeBreakProperty.txt, emoji/emoji-data.txt,
+# IndicSyllabicCategory.txt, Scripts.txt and extracted/DerivedCombiningClass.txt
+
+require_relative "lib/helper"
+
+if ARGV.length != 1
+  STDERR.puts "Syntax: #{$0} path_to_ucd"
+  exit 1
+end
+path_to_ucd = ARGV[0]
+
+grapheme_break_file_path = in_given_ucd_dir(path_to_ucd, "auxiliary/GraphemeBreakProperty.txt")
+unicode_version = read_unicode_version(grapheme_break_file_path)
+grapheme_break_properties = load_enumerated_property(grapheme_break_file_path)
+extended_pictographic = load_binary_property(in_given_ucd_dir(path_to_ucd, "emoji/emoji-data.txt"), "Extended_Pictographic")
+indic_syllabic_categories = load_enumerated_property(in_given_ucd_dir(path_to_ucd, "IndicSyllabicCategory.txt"))
+scripts = load_enumerated_property(in_given_ucd_dir(path_to_ucd, "Scripts.txt"))
+combining_classes = load_enumerated_property(in_given_ucd_dir(path_to_ucd, "extracted/DerivedCombiningClass.txt"))
+
+# ICU tailors the rules to not break inside the conjuncts of some Indic scripts ("LinkingConsonant ExtendCombining* Virama ExtendCombining* × LinkingConsonant",
+# ZWJ also being allowed between them), like rule GB9c that only appeared in Unicode 15.1.
+CONJUNCT_SCRIPTS = %w{Bengali Devanagari Gujarati Malayalam Oriya Telugu}
+
+# The values of the Grapheme_Cluster_Break property, plus Extended_Pictographic (for rule GB11) that is only given to characters that are Other,
+# and Extend and Other split for the Indic conjuncts.
+PROPERTIES = %w{
+  Other CR LF Control Extend ExtendCombining Virama ZWJ RegionalIndicator Prepend SpacingMark L V T LV LVT ExtendedPictographic LinkingConsonant
+}
+PROPERTY_COMMENTS = {
+  "ExtendCombining" => "Extend with a non-zero canonical combining class (that can be inside Indic conjuncts)",
+  "Virama" => "Extend that links the consonants of Indic conjuncts",
+  "ExtendedPictographic" => "Other with the Extended_Pictographic property",
+  "LinkingConsonant" => "Other that can be linked to other consonants by a virama",
+}
+
+properties = (0...0x110000).map do |codepoint|
+  property = (grapheme_break_properties[codepoint] || "Other").sub("Regional_Indicator", "RegionalIndicator")
+  raise "unknown grapheme cluster break property #{property}" unless PROPERTIES.include?(property)
+  if extended_pictographic[codepoint]
+    raise "Extended_Pictographic U+%04X is #{property}" % codepoint unless property == "Other"
+    property = "ExtendedPictographic"
+  end
+  if CONJUNCT_SCRIPTS.include?(scripts[codepoint])
+    case indic_syllabic_categories[codepoint]
+    when "Virama"
+      raise "virama U+%04X is #{property}" % codepoint unless property == "Extend" and combining_classes[codepoint] != "0"
+      property = "Virama"
+    when "Consonant"
+      raise "consonant U+%04X is #{property}" % codepoint unless property == "Other"
+      property = "LinkingConsonant"
+    end
+  end
+  property = "ExtendCombining" if property == "Extend" and combining_classes[codepoint] != "0"
+  property
+end
+# src/grapheme_cluster.cc considers code units before U+0300 (apart from CR) to always be grapheme clusters by themselves
+(0...0x300).each do |codepoint|
+  unless %w{Other ExtendedPictographic Control CR LF}.include?(properties[codepoint])
+    raise "U+%04X is #{properties[codepoint]}" % codepoint
+  end
+end
+
+# Rules of UAX #29 between two characters (GB3 to GB13, GB1 and GB2 being the start and end of the text).
+EXTEND = %w{Extend ExtendCombining Virama}
+def action(before, after)
+  if before == "CR" and after == "LF"  # GB3
+    "kNoBreak"
+  elsif %w{Control CR LF}.include?(before) or %w{Control CR LF}.include?(after)  # GB4 and GB5
+    "kBreak"
+  elsif before == "L" and %w{L V LV LVT}.include?(after)  # GB6
+    "kNoBreak"
+  elsif %w{LV V}.include?(before) and %w{V T}.include?(after)  # GB7
+    "kNoBreak"
+  elsif %w{LVT T}.include?(before) and after == "T"  # GB8
+    "kNoBreak"
+  elsif (EXTEND + %w{ZWJ SpacingMark}).include?(after) or before == "Prepend"  # GB9, GB9a and GB9b
+    "kNoBreak"
+  elsif %w{ExtendCombining Virama ZWJ}.include?(before) and after == "LinkingConsonant"  # ICU's Indic conjuncts
+    "kNoBreakInIndicConjunct"
+  elsif before == "ZWJ" and after == "ExtendedPictographic"  # GB11
+    "kNoBreakInEmojiSequence"
+  elsif before == "RegionalIndicator" and after == "RegionalIndicator"  # GB12 and GB13
+    "kNoBreakInRegionalIndicatorPair"
+  else  # GB999
+    "kBreak"
+  end
+end
+
+ACTIONS = %w{kBreak kNoBreak kNoBreakInEmojiSequence kNoBreakInIndicConjunct kNoBreakInRegionalIndicatorPair}
+ACTION_LETTERS = {
+  "kBreak" => "B",
+  "kNoBreak" => "N",
+  "kNoBreakInEmojiSequence" => "E",
+  "kNoBreakInIndicConjunct" => "I",
+  "kNoBreakInRegionalIndicatorPair" => "R",
+}
+
+output_file_path = in_src_dir("grapheme_cluster-data.hh")
+File.open(output_file_path, "w") do |output_file|
+  output_file.puts "// this file should only be included by grapheme_cluster.cc"
+  output_file.puts "// file automatically generated by scripts/#{File.basename(__FILE__)} from the data of Unicode #{unicode_version}, do not edit"
+  output_file.puts
+  output_file.puts "enum GraphemeClusterProperty : uint8_t {"
+  PROPERTIES.each do |property|
+    comment = PROPERTY_COMMENTS[property]
+    output_file.puts "  k#{property},#{comment ? "  // #{comment}" : ""}"
+  end
+  output_file.puts "};"
+  output_file.puts "static const int kGraphemeClusterPropertiesCount = #{PROPERTIES.length};"
+  output_file.puts
+  output_two_stage_table(output_file, "GraphemeCluster", "GraphemeClusterProperty", "Properties", properties.map {|property| "k#{property}" })
+  output_file.puts "enum GraphemeClusterAction : uint8_t {"
+  ACTIONS.each do |action|
+    output_file.puts "  #{action},"
+  end
+  output_file.puts "};"
+  ACTION_LETTERS.each do |action, letter|
+    output_file.puts "#define #{letter} #{action}"
+  end
+  output_file.puts "// What to do between the previous codepoint (the rows being its property) and the next one (the columns being its property)."
+  output_file.puts "static const GraphemeClusterAction kGraphemeClusterActions[kGraphemeClusterPropertiesCount][kGraphemeClusterPropertiesCount] = {"
+  PROPERTIES.each do |before|
+    actions = PROPERTIES.map {|after| ACTION_LETTERS[action(before, after)] }
+    output_file.puts "  { #{actions.join(",")} },  // #{before}"
+  end
+  output_file.puts "};"
+  ACTION_LETTERS.each_value do |letter|
+    output_file.puts "#undef #{letter}"
+  end
+end
+puts "generated #{output_file_path}"
@@ -240,7 +240,9 @@ File.open(output_file_path, "w") do |output_file|
 // this file should only be included by language.cc
 // file automatically generated by scripts/#{File.basename(__FILE__)}, do not edit
 
-static_assert(USCRIPT_CODE_LIMIT <= #{icu_scripts.length}, "USCRIPT_CODE_LIMIT is bigger than expected. You need to regenerate #{output_file_short_name} with the version of ICU you are using.");
+// The system's ICU might be more recent than the one used to generate this file (for example on Linux).
+// Scripts added since are handled as if we had no information about them.
+static const int kKnownScriptsCount = #{icu_scripts.length};
 // The language text from a script is most likely to be in if you don't have any other information.
 // The indices of kLikelyLanguageForScripts are USCRIPT_ values.
 // Note that most of the unknowns are for scripts we don't care about here as they are never used as Unicode properties.
@@ -0,0 +1,228 @@
+#!/usr/bin/ruby
+
+# Copyright © 2014  Vincent Isambart
+#
+#  This file is part of Glyphknit.
+#
+# Permission is hereby granted, without written agreement and without
+# license or royalty fees, to use, copy, modify, and distribute this
+# software and its documentation for any purpose, provided that the
+# above copyright notice and the following two paragraphs appear in
+# all copies of this software.
+#
+# IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+# DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+# ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+# IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+# DAMAGE.
+#
+# THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+# BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+# FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+# ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+# PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+
+# Generates the tables used by src/line_break.cc to find line break opportunities
+# following the Unicode Line Breaking Algorithm (UAX #14).
+#
+# To give the same results as ICU's line break iterators, the data must be the one
+# of the Unicode version used by the ICU glyphknit is compared with (Unicode 15.0 for ICU 72),
+# so the path to the UCD directory of that version has to be given.
+# Are needed (with the same layout as on unicode.org): LineBreak.txt, EastAsianWidth.txt,
+# emoji/emoji-data.txt and extracted/DerivedGeneralCategory.txt
+
+require_relative "lib/helper"
+
+if ARGV.length != 1
+  STDERR.puts "Syntax: #{$0} path_to_ucd"
+  exit 1
+end
+path_to_ucd = ARGV[0]
+
+line_break_file_path = in_given_ucd_dir(path_to_ucd, "LineBreak.txt")
+unicode_version = read_unicode_version(line_break_file_path)
+line_break_properties = load_enumerated_property(line_break_file_path)
+east_asian_widths = load_enumerated_property(in_given_ucd_dir(path_to_ucd, "EastAsianWidth.txt"))
+general_categories = load_enumerated_property(in_given_ucd_dir(path_to_ucd, "extracted/DerivedGeneralCategory.txt"))
+extended_pictographic = load_binary_property(in_given_ucd_dir(path_to_ucd, "emoji/emoji-data.txt"), "Extended_Pictographic")
+
+# The classes of UAX #14, with AI, SG, XX and CJ already resolved (rule LB1),
+# and some classes split in two for the rules only applying to some of their characters.
+# SA characters are not resolved because their text has to be broken with a dictionary.
+CLASSES = %w{
+  BK CR LF NL SP ZW ZWJ CM WJ GL BA HY BB B2 CB NS EX IS SY CL CP CPEastAsian OP OPEastAsian
+  QU IN NU PR PO AL HL ID IDUnassignedPictographic EB EM JL JV JT H2 H3 RI SA
+}
+CLASS_COMMENTS = {
+  "CPEastAsian" => "CP with an East Asian width of F, W or H (not concerned by rule LB30)",
+  "OPEastAsian" => "OP with an East Asian width of F, W or H (not concerned by rule LB30)",
+  "IDUnassignedPictographic" => "unassigned Extended_Pictographic codepoints (rule LB30b)",
+}
+
+def resolve_class(line_break, east_asian_width, general_category, extended_pictographic)
+  case line_break
+  when "AI", "SG", "XX"
+    "AL"
+  when "CJ"
+    "NS"
+  when "OP", "CP"
+    %w{F W H}.include?(east_asian_width) ? "#{line_break}EastAsian" : line_break
+  when "ID"
+    (extended_pictographic and general_category == "Cn") ? "IDUnassignedPictographic" : line_break
+  else
+    raise "unknown line break class #{line_break}" unless CLASSES.include?(line_break)
+    line_break
+  end
+end
+
+classes = (0...0x110000).map do |codepoint|
+  resolve_class(line_break_properties[codepoint] || "XX", east_asian_widths[codepoint], general_categories[codepoint], extended_pictographic[codepoint])
+end
+(0...0x110000).each do |codepoint|
+  if extended_pictographic[codepoint] and general_categories[codepoint] == "Cn" and classes[codepoint] != "IDUnassignedPictographic"
+    raise "unassigned Extended_Pictographic U+%04X is not ID" % codepoint
+  end
+end
+
+# Rules of UAX #14 between two classes, once rules LB4 to LB10 (mandatory breaks, spaces and combining marks) have been applied.
+# LB25 is the regular expression of example 7 of section 8.2 (the same as ICU and the tests of the UCD).
+OPEN = %w{OP OPEastAsian}
+CLOSE = %w{CL CP CPEastAsian}
+IDEOGRAPHIC = %w{ID IDUnassignedPictographic EB EM}
+ALPHABETIC = %w{AL HL}
+HANGUL = %w{JL JV JT H2 H3}
+
+def rules_after_lb21(before, after)
+  return :kNoBreak if before == "SY" and after == "HL"  # LB21b
+  return :kNoBreak if after == "IN"  # LB22
+  return :kNoBreak if ALPHABETIC.include?(before) and after == "NU"  # LB23
+  return :kNoBreak if before == "NU" and ALPHABETIC.include?(after)
+  return :kNoBreak if before == "PR" and IDEOGRAPHIC.include?(after)  # LB23a
+  return :kNoBreak if IDEOGRAPHIC.include?(before) and after == "PO"
+  return :kNoBreak if %w{PR PO}.include?(before) and ALPHABETIC.include?(after)  # LB24
+  return :kNoBreak if ALPHABETIC.include?(before) and %w{PR PO}.include?(after)
+  # LB25: (PR | PO)? (OP | HY)? NU (NU | SY | IS)* (CL | CP)? (PR | PO)?
+  return :kNoBreak if %w{PR PO}.include?(before) and after == "NU"
+  return :kNoBreakIfNumberFollows if %w{PR PO}.include?(before) and OPEN.include?(after)
+  return :kNoBreak if (OPEN + %w{HY}).include?(before) and after == "NU"
+  return :kNoBreak if before == "NU" and %w{NU SY IS}.include?(after)
+  return :kNoBreak if before == "IS" and after == "NU"  # as in ICU, even when not after a number
+  return :kNoBreakInNumber if before == "SY" and after == "NU"
+  return :kNoBreakInNumber if (%w{NU SY IS} + CLOSE).include?(before) and %w{PR PO}.include?(after)
+  return :kNoBreak if before == "JL" and %w{JL JV H2 H3}.include?(after)  # LB26
+  return :kNoBreak if %w{JV H2}.include?(before) and %w{JV JT}.include?(after)
+  return :kNoBreak if %w{JT H3}.include?(before) and after == "JT"
+  return :kNoBreak if HANGUL.include?(before) and after == "PO"  # LB27
+  return :kNoBreak if before == "PR" and HANGUL.include?(after)
+  return :kNoBreak if ALPHABETIC.include?(before) and ALPHABETIC.include?(after)  # LB28
+  return :kNoBreak if before == "IS" and ALPHABETIC.include?(after)  # LB29
+  return :kNoBreak if (ALPHABETIC + %w{NU}).include?(before) and after == "OP"  # LB30
+  return :kNoBreak if before == "CP" and (ALPHABETIC + %w{NU}).include?(after)
+  return :kNoBreakInRegionalIndicatorPair if before == "RI" and after == "RI"  # LB30a
+  return :kNoBreak if %w{EB IDUnassignedPictographic}.include?(before) and after == "EM"  # LB30b
+  :kBreak  # LB31
+end
+
+def pair_action(before, after)
+  before = "AL" if before == "SA"
+  after = "AL" if after == "SA"
+  return :kNoBreak if after == "WJ" or before == "WJ"  # LB11
+  return :kNoBreak if before == "GL"  # LB12
+  return :kNoBreak if after == "GL" and !%w{SP BA HY}.include?(before)  # LB12a
+  return :kNoBreak if (CLOSE + %w{EX IS SY}).include?(after)  # LB13
+  return :kNoBreak if OPEN.include?(before)  # LB14
+  return :kNoBreak if before == "QU" and OPEN.include?(after)  # LB15
+  return :kNoBreak if CLOSE.include?(before) and after == "NS"  # LB16
+  return :kNoBreak if before == "B2" and after == "B2"  # LB17
+  return :kNoBreak if after == "QU" or before == "QU"  # LB19
+  return :kBreak if after == "CB" or before == "CB"  # LB20
+  return :kNoBreak if %w{BA HY NS}.include?(after) or before == "BB"  # LB21
+  action = rules_after_lb21(before, after)
+  if action == :kBreak and %w{HY BA}.include?(before)
+    if before == "HY" and after == "AL"
+      # LB21a, and ICU's tailoring to not break a hyphen that has a break opportunity before it from a word ("-word" or "3 -word")
+      action = :kNoBreakAfterHebrewLetterOrBreak
+    else
+      action = :kNoBreakAfterHebrewLetter  # LB21a
+    end
+  end
+  action
+end
+
+# the same after spaces, "before" being the class before the spaces
+def action_after_spaces(before, after)
+  return :kNoBreak if after == "WJ"  # LB11
+  return :kBreakIfNumberFollows if after == "IS" and !OPEN.include?(before)  # as in ICU, " .5" can be broken before the IS
+  return :kNoBreak if (CLOSE + %w{EX IS SY}).include?(after)  # LB13
+  return :kNoBreak if OPEN.include?(before)  # LB14
+  return :kNoBreak if before == "QU" and OPEN.include?(after)  # LB15
+  return :kNoBreak if CLOSE.include?(before) and after == "NS"  # LB16
+  return :kNoBreak if before == "B2" and after == "B2"  # LB17
+  :kBreak  # LB18
+end
+
+MANDATORY_BREAKS = %w{BK CR LF NL}
+COMBINING_MARKS = %w{CM ZWJ}
+
+# What to do between the previous character (of class "before", followed by spaces if after_spaces is true) and the next codepoint.
+# Rule LB8a (ZWJ ×) has to be applied separately as the ZWJ is attached to the character before it.
+def action(before, after_spaces, after)
+  unless after_spaces
+    return :kBreak if %w{BK LF NL}.include?(before)  # LB4, LB5
+    return (after == "LF" ? :kNoBreak : :kBreak) if before == "CR"
+  end
+  return :kNoBreak if (MANDATORY_BREAKS + %w{SP ZW}).include?(after)  # LB6, LB7
+  return :kBreak if before == "ZW"  # LB8
+  if COMBINING_MARKS.include?(after)
+    return :kAttach unless after_spaces  # LB9
+    after = "AL"  # LB10
+  end
+  after_spaces ? action_after_spaces(before, after) : pair_action(before, after)
+end
+
+# kBreak and kNoBreak must be first
+ACTIONS = %i{kBreak kNoBreak kAttach kNoBreakInNumber kNoBreakIfNumberFollows kBreakIfNumberFollows kNoBreakAfterHebrewLetter kNoBreakAfterHebrewLetterOrBreak kNoBreakInRegionalIndicatorPair}
+ACTION_LETTERS = {
+  kBreak: "B", kNoBreak: "N", kAttach: "A", kNoBreakInNumber: "U", kNoBreakIfNumberFollows: "F", kBreakIfNumberFollows: "S",
+  kNoBreakAfterHebrewLetter: "H", kNoBreakAfterHebrewLetterOrBreak: "W", kNoBreakInRegionalIndicatorPair: "R",
+}
+
+output_file_path = in_src_dir("line_break-data.hh")
+File.open(output_file_path, "w") do |output_file|
+  output_file.puts "// this file should only be included by line_break.cc"
+  output_file.puts "// file automatically generated by scripts/#{File.basename(__FILE__)} from the data of Unicode #{unicode_version}, do not edit"
+  output_file.puts
+  output_file.puts "enum LineBreakClass : uint8_t {"
+  CLASSES.each do |line_break_class|
+    comment = CLASS_COMMENTS[line_break_class]
+    output_file.puts "  k#{line_break_class},#{comment ? "  // #{comment}" : ""}"
+  end
+  output_file.puts "};"
+  output_file.puts "static const int kLineBreakClassesCount = #{CLASSES.length};"
+  output_file.puts
+  output_two_stage_table(output_file, "LineBreak", "LineBreakClass", "Classes", classes.map {|line_break_class| "k#{line_break_class}" })
+  output_file.puts "enum LineBreakAction : uint8_t {"
+  ACTIONS.each do |action|
+    output_file.puts "  #{action},"
+  end
+  output_file.puts "};"
+  ACTION_LETTERS.each do |action, letter|
+    output_file.puts "#define #{letter} #{action}"
+  end
+  output_file.puts "// What to do between the previous character and the next codepoint (the columns being its class)."
+  output_file.puts "// The first kLineBreakClassesCount rows are for the class of the previous character,"
+  output_file.puts "// the next ones for the class of the last character that was not a space when the previous character was a space."
+  output_file.puts "// CM and ZWJ are handled as AL when they are not attached to the previous character."
+  output_file.puts "static const LineBreakAction kLineBreakActions[2 * kLineBreakClassesCount][kLineBreakClassesCount] = {"
+  [false, true].each do |after_spaces|
+    CLASSES.each do |before|
+      actions = CLASSES.map {|after| ACTION_LETTERS[action(before, after_spaces, after)] }
+      output_file.puts "  { #{actions.join(",")} },  // #{before}#{after_spaces ? " SP+" : ""}"
+    end
+  end
+  output_file.puts "};"
+  ACTION_LETTERS.each_value do |letter|
+    output_file.puts "#undef #{letter}"
+  end
+end
+puts "generated #{output_file_path}"
@@ -86,3 +86,90 @@ def load_script_for_codepoints
   end
   scripts
 end
+
+# for UCD files of another version than UNICODE_VERSION
+def in_given_ucd_dir(path_to_ucd, filename)
+  path = File.join(path_to_ucd, filename)
+  unless File.exist?(path)
+    STDERR.puts "cannot find #{filename} in #{path_to_ucd}"
+    exit 1
+  end
+  path
+end
+
+def each_codepoint_of_field(codepoints)
+  if md = /\A([0-9A-F]+)\.\.([0-9A-F]+)\z/i.match(codepoints) # codepoints range
+    first, last = md[1].hex, md[2].hex
+  elsif md = /\A([0-9A-F]+)\z/i.match(codepoints) # 1 codepoint
+    first = last = md[1].hex
+  else
+    raise "invalid codepoints #{codepoints.inspect}"
+  end
+  (first..last).each {|codepoint| yield codepoint }
+end
+
+# Reads a property giving a value to all codepoints.
+# The default values of codepoints not in the file are given by "@missing" lines.
+def load_enumerated_property(file_path)
+  values = Array.new(0x110000)
+  File.open(file_path, encoding: Encoding::UTF_8) do |f|
+    f.each_line do |line|
+      next unless md = /\A#\s*@missing:\s*(.*)\z/.match(line.strip)
+      codepoints, value = md[1].split(/\s*;\s*/)
+      each_codepoint_of_field(codepoints) {|codepoint| values[codepoint] = value }
+    end
+  end
+  each_file_of_unicode_data_file(file_path) do |codepoints, value|
+    each_codepoint_of_field(codepoints) {|codepoint| values[codepoint] = value }
+  end
+  values
+end
+
+def load_binary_property(file_path, property_name)
+  values = Array.new(0x110000, false)
+  each_file_of_unicode_data_file(file_path) do |codepoints, property|
+    next unless property == property_name
+    each_codepoint_of_field(codepoints) {|codepoint| values[codepoint] = true }
+  end
+  values
+end
+
+# the version in the header of a UCD file (for example "# LineBreak-15.0.0.txt")
+def read_unicode_version(file_path)
+  File.open(file_path, &:gets)[/-([0-9.]+)\.txt/, 1] or raise "cannot find the Unicode version in the header of #{file_path}"
+end
+
+# Outputs a two-stage table of the values (C++ expressions) of all codepoints:
+# the codepoints are split in blocks of the same size, and identical blocks are only stored once.
+# The value of codepoint c is k<prefix><name>[(k<prefix>Blocks[c >> k<prefix>BlockShift] << k<prefix>BlockShift) + (c & (k<prefix>BlockSize-1))]
+def output_two_stage_table(output_file, prefix, type, name, values, block_shift = 7)
+  block_size = 1 << block_shift
+  blocks = []
+  block_indexes = {}
+  stage1 = (0...(0x110000 / block_size)).map do |block_number|
+    block = values[block_number * block_size, block_size]
+    block_indexes[block] ||= begin
+      blocks << block
+      blocks.length - 1
+    end
+  end
+  raise "too many blocks" if blocks.length > 0xFFFF
+
+  output_file.puts "// the #{name.downcase} of codepoint c are in k#{prefix}#{name}[(k#{prefix}Blocks[c >> k#{prefix}BlockShift] << k#{prefix}BlockShift) + (c & (k#{prefix}BlockSize-1))]"
+  output_file.puts "static const int k#{prefix}BlockShift = #{block_shift};"
+  output_file.puts "static const int k#{prefix}BlockSize = #{block_size};"
+  output_file.puts "static const uint16_t k#{prefix}Blocks[] = {"
+  stage1.each_slice(16) do |slice|
+    output_file.puts "  #{slice.map {|block_index| "%3d," % block_index }.join(" ")}"
+  end
+  output_file.puts "};"
+  output_file.puts "static const #{type} k#{prefix}#{name}[] = {"
+  blocks.each_with_index do |block, block_index|
+    output_file.puts "  // block #{block_index}"
+    block.each_slice(16) do |slice|
+      output_file.puts "  #{slice.map {|value| "#{value}," }.join(" ")}"
+    end
+  end
+  output_file.puts "};"
+  output_file.puts
+end
@@ -23,12 +23,22 @@
  */
 
 #include "font.hh"
-#include "autorelease.hh"
 
 #include FT_TRUETYPE_TABLES_H
 #include FT_TRUETYPE_TAGS_H
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __APPLE__
+#include "autorelease.hh"
 #include <CoreFoundation/CoreFoundation.h>
 #include <sys/param.h>
+#endif
 
 namespace glyphknit {
 
@@ -152,27 +162,161 @@ static FontFamilyClass ResolveFontFamilyClass(FT_Face ft_face) {
   return FontFamilyClass::kUnknown;
 }
 
+// set of the characters a font has a glyph for, as a bitmap split in pages of 256 characters
+class CharacterCoverage {
+ public:
+  explicit CharacterCoverage(FT_Face);
+  bool Contains(UChar32 codepoint) const {
+    auto page_number = uint32_t(codepoint) >> 8;
+    if (page_number >= page_indices_.size()) {
+      return false;
+    }
+    const auto &page = pages_[page_indices_[page_number]];
+    return (page[(codepoint & 0xff) >> 6] >> (codepoint & 0x3f)) & 1;
+  }
+
+ private:
+  typedef std::array<uint64_t, 4> Page;
+  // index in pages_ of each page, all the pages without any character share the first one
+  std::vector<uint16_t> page_indices_;
+  std::vector<Page> pages_;
+};
+
+CharacterCoverage::CharacterCoverage(FT_Face ft_face) : pages_(1, Page{}) {
+  FT_UInt glyph_index;
+  for (auto codepoint = FT_Get_First_Char(ft_face, &glyph_index); glyph_index != 0; codepoint = FT_Get_Next_Char(ft_face, codepoint, &glyph_index)) {
+    auto page_number = codepoint >> 8;
+    if (page_number >= page_indices_.size()) {
+      page_indices_.resize(page_number + 1, 0);
+    }
+    if (page_indices_[page_number] == 0) {
+      page_indices_[page_number] = uint16_t(pages_.size());
+      pages_.emplace_back(Page{});
+    }
+    pages_[page_indices_[page_number]][(codepoint & 0xff) >> 6] |= uint64_t(1) << (codepoint & 0x3f);
+  }
+}
+
+// contents of a font file, shared by all the faces using it
+// FreeType and HarfBuzz read the fonts directly from there so it is only mapped once
+class FontFile {
+ public:
+  static std::shared_ptr<FontFile> Map(const char *path);  // returns nullptr if the file cannot be read
+  FontFile(const void *data, size_t length) : data_{static_cast<const FT_Byte *>(data)}, length_{length}, mapped_{false} {}  // the data is not copied
+  FontFile(const FontFile &) = delete;
+  FontFile &operator=(const FontFile &) = delete;
+  ~FontFile();
+
+  FT_Face CreateFTFace(int face_index) const;  // returns nullptr if there is no face at that index
+
+ private:
+  const FT_Byte *data_;
+  size_t length_;
+  bool mapped_;
+};
+
+std::shared_ptr<FontFile> FontFile::Map(const char *path) {
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat file_stat;
+  void *data = MAP_FAILED;
+  if (fstat(fd, &file_stat) == 0 && file_stat.st_size > 0) {
+    data = mmap(nullptr, size_t(file_stat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  close(fd);  // the mapping stays valid after the file is closed
+  if (data == MAP_FAILED) {
+    return nullptr;
+  }
+  auto font_file = std::make_shared<FontFile>(data, size_t(file_stat.st_size));
+  font_file->mapped_ = true;
+  return font_file;
+}
+
+FontFile::~FontFile() {
+  if (mapped_) {
+    munmap(const_cast<FT_Byte *>(data_), length_);
+  }
+}
+
+FT_Face FontFile::CreateFTFace(int face_index) const {
+  FT_Face ft_face;
+  auto error = FT_New_Memory_Face(FontManager::instance()->ft_library(), data_, FT_Long(length_), face_index, &ft_face);
+  if (error) {
+    return nullptr;
+  }
+  return ft_face;
+}
+
+// languages having their own fallback fonts (see GetLanguageFallbackFonts), plus one for all the other languages
+static const size_t kLanguageFallbackFontsCount = 5;
+
+static const hb_position_t kUnknownNominalAdvance = INT32_MIN;
+
 class FontDescriptor::Data {
  public:
+#ifdef __APPLE__
   AutoReleasedCFRef<CTFontDescriptorRef> &native_font_descriptor() { return native_font_descriptor_; }
-  Data(AutoReleasedCFRef<CTFontDescriptorRef> &&);
+  Data(AutoReleasedCFRef<CTFontDescriptorRef> &&, std::shared_ptr<FontFile>);
+  AutoReleasedCFRef<CTFontRef> CreateNativeFont(float size) const;
+#else
+  Data(std::shared_ptr<FontFile>, FT_Face);
+#endif
   ~Data();
   FT_Face GetFTFace() const;
   hb_font_t *GetHBFont() const;
-  AutoReleasedCFRef<CTFontRef> CreateNativeFont(float size) const;
-  bool operator ==(const Data &) const;
+  hb_shape_plan_t *GetShapePlan(const hb_segment_properties_t &) const;
+  hb_position_t GetNominalAdvance(hb_codepoint_t glyph) const;
   FontFamilyClass font_family_class() const {
     GetFTFace();  // needed so that the family class is resolved
     return font_family_class_;
   }
+  const std::string &postscript_name() const { return postscript_name_; }
+  FontDescriptor GetFallback(size_t index, Language);
+  bool CoversCharacter(UChar32 codepoint) const {
+    if (!coverage_) {
+      coverage_.reset(new CharacterCoverage(GetFTFace()));
+    }
+    return coverage_->Contains(codepoint);
+  }
 
  private:
+  void SetFTFace(FT_Face) const;
+
+  // fallback fonts resolved so far, lazily filled as more fallbacks are needed
+  // (they are never freed, but fonts are never freed by the FontManager anyway)
+  struct FallbackChain {
+    std::vector<FontDescriptor> fonts;
+    size_t next_font_name_index;
+    bool complete;
+    // the fonts loaded after the chain was resolved might be part of it, so it is then resolved again
+    size_t fonts_generation;
+  };
+
+#ifdef __APPLE__
   AutoReleasedCFRef<CTFontDescriptorRef> native_font_descriptor_;
+#endif
+  std::string postscript_name_;
+  // must be kept as long as the face is used (mutable as it is only known when the face is created with Core Text)
+  mutable std::shared_ptr<FontFile> font_file_;
   mutable FT_Face ft_face_;
   mutable hb_font_t *hb_font_;
+  // there are usually only a few different segment properties used with a font so a linear search is fine
+  struct CachedShapePlan {
+    hb_segment_properties_t segment_properties;
+    hb_shape_plan_t *shape_plan;
+  };
+  mutable std::vector<CachedShapePlan> shape_plans_;
+  // by glyph id, kUnknownNominalAdvance until first needed
+  mutable std::vector<hb_position_t> nominal_advances_;
   // The font family class is mutable because we need the FT_Face to be able to compute it.
   // TODO: Creating the FT_Face from the constructor might be a better idea.
   mutable FontFamilyClass font_family_class_;
+  // built the first time it is needed as going through all the characters of a font is not that cheap
+  mutable std::unique_ptr<CharacterCoverage> coverage_;
+  // one chain for each set of language-specific fallback fonts
+  FallbackChain fallback_chains_[kLanguageFallbackFontsCount];
 };
 
 /*
@@ -184,6 +328,9 @@ static bool FaceContainsTable(FT_Face face, FT_ULong tag) {
 */
 
 FontDescriptor::Data::~Data() {
+  for (auto &cached_shape_plan : shape_plans_) {
+    hb_shape_plan_destroy(cached_shape_plan.shape_plan);
+  }
   // be careful: the hb_font_t must be destroyed before destroying the FreeType face
   if (hb_font_ != nullptr) {
     hb_font_destroy(hb_font_);
@@ -193,13 +340,6 @@ FontDescriptor::Data::~Data() {
   }
 }
 
-FontDescriptor::Data::Data(AutoReleasedCFRef<CTFontDescriptorRef> &&native_font_descriptor) : native_font_descriptor_{native_font_descriptor}, ft_face_{nullptr}, hb_font_{nullptr}, font_family_class_(FontFamilyClass::kUnknown) {
-}
-
-AutoReleasedCFRef<CTFontRef> FontDescriptor::Data::CreateNativeFont(float size) const {
-  return {CTFontCreateWithFontDescriptor(native_font_descriptor_.get(), size, nullptr)};
-}
-
 hb_font_t *FontDescriptor::Data::GetHBFont() const {
   if (hb_font_ == nullptr) {
     hb_font_ = hb_ft_font_create(GetFTFace(), nullptr);
@@ -207,41 +347,91 @@ hb_font_t *FontDescriptor::Data::GetHBFont() const {
   return hb_font_;
 }
 
-FT_Face FontDescriptor::Data::GetFTFace() const {
-  if (ft_face_ != nullptr) {
-    return ft_face_;
+hb_shape_plan_t *FontDescriptor::Data::GetShapePlan(const hb_segment_properties_t &segment_properties) const {
+  for (const auto &cached_shape_plan : shape_plans_) {
+    if (hb_segment_properties_equal(&cached_shape_plan.segment_properties, &segment_properties)) {
+      return cached_shape_plan.shape_plan;
+    }
+  }
+  auto shape_plan = hb_shape_plan_create(hb_font_get_face(GetHBFont()), &segment_properties, nullptr, 0, nullptr);
+  shape_plans_.push_back(CachedShapePlan{segment_properties, shape_plan});
+  return shape_plan;
+}
+
+hb_position_t FontDescriptor::Data::GetNominalAdvance(hb_codepoint_t glyph) const {
+  if (nominal_advances_.empty()) {
+    nominal_advances_.assign(size_t(std::max(GetFTFace()->num_glyphs, FT_Long(1))), kUnknownNominalAdvance);
+  }
+  if (glyph >= nominal_advances_.size()) {
+    return hb_font_get_glyph_h_advance(GetHBFont(), glyph);
+  }
+  auto &nominal_advance = nominal_advances_[glyph];
+  if (nominal_advance == kUnknownNominalAdvance) {
+    nominal_advance = hb_font_get_glyph_h_advance(GetHBFont(), glyph);
   }
-  auto url = MakeAutoReleasedCFRef<CFURLRef>(CTFontDescriptorCopyAttribute(native_font_descriptor_.get(), kCTFontURLAttribute));
-  assert(url.get() != nullptr);
+  return nominal_advance;
+}
+
+void FontDescriptor::Data::SetFTFace(FT_Face ft_face) const {
+  // get all the measurements in font points, we'll handle scaling by ourselves
+  auto error = FT_Set_Char_Size(ft_face, 0, ft_face->units_per_EM, 0, 0);
+  assert(!error);
+  (void)error;  // only used by the assert
+
+//  assert(!FaceContainsTable(ft_face, TTAG_morx));
 
-  char path[MAXPATHLEN];
-  auto could_get_representation = CFURLGetFileSystemRepresentation(url.get(), true, reinterpret_cast<uint8_t *>(path), sizeof(path));
-  assert(could_get_representation);
+  font_family_class_ = ResolveFontFamilyClass(ft_face);
+  ft_face_ = ft_face;
+}
 
-  auto font_name = MakeAutoReleasedCFRef<CFStringRef>(CTFontDescriptorCopyAttribute(native_font_descriptor_.get(), kCTFontNameAttribute));
+#ifdef __APPLE__
 
-  // TODO: save PostScript name in instance variable?
+static std::string CopyPostScriptName(CTFontDescriptorRef native_font_descriptor) {
+  auto font_name = MakeAutoReleasedCFRef<CFStringRef>(CTFontDescriptorCopyAttribute(native_font_descriptor, kCTFontNameAttribute));
 
   // the OpenType spec says that the Postscript name of a font should be no longer than 63 characters
   // http://www.microsoft.com/typography/otspec/name.htm
-  char searched_postscript_name[64];
-  auto could_get_cstring = CFStringGetCString(font_name.get(), searched_postscript_name, sizeof(searched_postscript_name), kCFStringEncodingUTF8);
+  char postscript_name[64];
+  auto could_get_cstring = CFStringGetCString(font_name.get(), postscript_name, sizeof(postscript_name), kCFStringEncodingUTF8);
   assert(could_get_cstring);
+  return postscript_name;
+}
 
-  auto ft_library = FontManager::instance()->ft_library();
+FontDescriptor::Data::Data(AutoReleasedCFRef<CTFontDescriptorRef> &&native_font_descriptor, std::shared_ptr<FontFile> font_file) : native_font_descriptor_{native_font_descriptor}, postscript_name_{CopyPostScriptName(native_font_descriptor_.get())}, font_file_{std::move(font_file)}, ft_face_{nullptr}, hb_font_{nullptr}, font_family_class_(FontFamilyClass::kUnknown), fallback_chains_{} {
+}
 
-  FT_Error error;
-  FT_Face ft_face;
-  error = FT_New_Face(ft_library, path, 0, &ft_face);
-  assert(!error);
+AutoReleasedCFRef<CTFontRef> FontDescriptor::Data::CreateNativeFont(float size) const {
+  return {CTFontCreateWithFontDescriptor(native_font_descriptor_.get(), size, nullptr)};
+}
+
+FT_Face FontDescriptor::Data::GetFTFace() const {
+  if (ft_face_ != nullptr) {
+    return ft_face_;
+  }
+  if (!font_file_) {
+    auto url = MakeAutoReleasedCFRef<CFURLRef>(CTFontDescriptorCopyAttribute(native_font_descriptor_.get(), kCTFontURLAttribute));
+    assert(url.get() != nullptr);
 
+    char path[MAXPATHLEN];
+    auto could_get_representation = CFURLGetFileSystemRepresentation(url.get(), true, reinterpret_cast<uint8_t *>(path), sizeof(path));
+    assert(could_get_representation);
+
+    font_file_ = FontManager::instance()->MapFontFile(path);
+    assert(font_file_);
+  }
+
+  // the face with the same PostScript name has to be found in font collections
+  // (creating faces from a file in memory is cheap)
+  auto searched_postscript_name = postscript_name_.c_str();
+  FT_Face ft_face = font_file_->CreateFTFace(0);
+  assert(ft_face != nullptr);
   if (strcmp(searched_postscript_name, FT_Get_Postscript_Name(ft_face)) != 0) {
     auto num_faces = ft_face->num_faces;
     FT_Done_Face(ft_face);
     ft_face = nullptr;
     for (int face_index = 1; face_index < num_faces; ++face_index) {
-      error = FT_New_Face(ft_library, path, face_index, &ft_face);
-      assert(!error);
+      ft_face = font_file_->CreateFTFace(face_index);
+      assert(ft_face != nullptr);
 
       if (strcmp(searched_postscript_name, FT_Get_Postscript_Name(ft_face)) == 0) {
         break;
@@ -252,32 +442,26 @@ FT_Face FontDescriptor::Data::GetFTFace() const {
   }
   assert(ft_face != nullptr);
 
-  // get all the measurements in font points, we'll handle scaling by ourselves
-  error = FT_Set_Char_Size(ft_face, 0, ft_face->units_per_EM, 0, 0);
-  assert(!error);
-
-//  assert(!FaceContainsTable(ft_face, TTAG_morx));
-
-  font_family_class_ = ResolveFontFamilyClass(ft_face);
-  ft_face_ = ft_face;
-
+  SetFTFace(ft_face);
   return ft_face;
 }
 
-bool FontDescriptor::Data::operator ==(const FontDescriptor::Data &compared_to) const {
-  if (this == &compared_to || CFEqual(native_font_descriptor_.get(), compared_to.native_font_descriptor_.get())) {
-    return true;
+#else
+
+FontDescriptor::Data::Data(std::shared_ptr<FontFile> font_file, FT_Face ft_face) : font_file_{std::move(font_file)}, ft_face_{nullptr}, hb_font_{nullptr}, font_family_class_(FontFamilyClass::kUnknown), fallback_chains_{} {
+  auto postscript_name = FT_Get_Postscript_Name(ft_face);
+  if (postscript_name != nullptr) {
+    postscript_name_ = postscript_name;
   }
-  auto font_name = MakeAutoReleasedCFRef<CFStringRef>(CTFontDescriptorCopyAttribute(native_font_descriptor_.get(), kCTFontNameAttribute));
-  auto font_name_to_compare_to = MakeAutoReleasedCFRef<CFStringRef>(CTFontDescriptorCopyAttribute(compared_to.native_font_descriptor_.get(), kCTFontNameAttribute));
-  return CFEqual(font_name.get(), font_name_to_compare_to.get());
+  SetFTFace(ft_face);
 }
 
-
-bool FontDescriptor::operator ==(const FontDescriptor &compared_to) const {
-  return *data_ == *compared_to.data_;
+FT_Face FontDescriptor::Data::GetFTFace() const {
+  return ft_face_;
 }
 
+#endif
+
 FT_Face FontDescriptor::GetFTFace() const {
   assert(is_valid());
   return data_->GetFTFace();
@@ -286,16 +470,37 @@ hb_font_t *FontDescriptor::GetHBFont() const {
   assert(is_valid());
   return data_->GetHBFont();
 }
+hb_shape_plan_t *FontDescriptor::GetShapePlan(const hb_segment_properties_t &segment_properties) const {
+  assert(is_valid());
+  return data_->GetShapePlan(segment_properties);
+}
+hb_position_t FontDescriptor::GetNominalAdvance(hb_codepoint_t glyph) const {
+  assert(is_valid());
+  return data_->GetNominalAdvance(glyph);
+}
+#ifdef __APPLE__
 AutoReleasedCFRef<CTFontRef> FontDescriptor::CreateNativeFont(float size) const {
   assert(is_valid());
   return data_->CreateNativeFont(size);
 }
+#endif
+bool FontDescriptor::CoversCharacter(UChar32 codepoint) const {
+  assert(is_valid());
+  return data_->CoversCharacter(codepoint);
+}
 FontFamilyClass FontDescriptor::font_family_class() const {
   assert(is_valid());
   return data_->font_family_class();
 }
-FontDescriptor::FontDescriptor(AutoReleasedCFRef<CTFontDescriptorRef> &&native_font_descriptor) : data_(std::make_shared<FontDescriptor::Data>(std::move(native_font_descriptor))) {
+#ifdef __APPLE__
+FontDescriptor::FontDescriptor(AutoReleasedCFRef<CTFontDescriptorRef> &&native_font_descriptor, std::shared_ptr<FontFile> font_file) : data_(std::make_shared<FontDescriptor::Data>(std::move(native_font_descriptor), std::move(font_file))) {
 }
+#else
+FontDescriptor::FontDescriptor(std::shared_ptr<FontFile> font_file, FT_Face ft_face) : data_(std::make_shared<FontDescriptor::Data>(std::move(font_file), ft_face)) {
+}
+#endif
+
+#ifdef __APPLE__
 
 static const char *kSansSerifFallbackFonts[] = {
   "Helvetica",
@@ -420,73 +625,150 @@ static const char *kMonospaceFallbackFonts[] = {
   "PlantagenetCherokee",
 };
 
-FontDescriptor FontDescriptor::GetFallback(size_t index, Language language) {
-  assert(is_valid());
-  if (index == 0) {
-    return *this;
-  }
-  --index;
+#else
+// fonts commonly available under an open-source license
+// as there is no system-wide font lookup, only the ones that have been loaded from a file can be used
+static const char *kSansSerifFallbackFonts[] = {
+  "DejaVuSans",
+  "NotoSansSymbols-Regular",
+  "NotoNaskhArabic-Regular",
+  "NotoSansHebrew-Regular",
+  "NotoSansThai-Regular",
+  "NotoSansDevanagari-Regular",
+  "NotoSansBengali-Regular",
+  "NotoSansGujarati-Regular",
+  "NotoSansGurmukhi-Regular",
+  "NotoSansKannada-Regular",
+  "NotoSansKhmer-Regular",
+  "NotoSansLao-Regular",
+  "NotoSansMalayalam-Regular",
+  "NotoSansMyanmar-Regular",
+  "NotoSansOriya-Regular",
+  "NotoSansSinhala-Regular",
+  "NotoSansTamil-Regular",
+  "NotoSansTelugu-Regular",
+  "NotoSansArmenian-Regular",
+  "NotoSansCanadianAboriginal-Regular",
+  "NotoSansCherokee-Regular",
+  "NotoSansCJKjp-Regular",
+};
+static const char *kSerifFallbackFonts[] = {
+  "DejaVuSerif",
+  "DejaVuSans",
+  "NotoSansSymbols-Regular",
+  "NotoNaskhArabic-Regular",
+  "NotoSerifHebrew-Regular",
+  "NotoSerifThai-Regular",
+  "NotoSerifDevanagari-Regular",
+  "NotoSerifBengali-Regular",
+  "NotoSerifGujarati-Regular",
+  "NotoSerifGurmukhi-Regular",
+  "NotoSerifKannada-Regular",
+  "NotoSerifKhmer-Regular",
+  "NotoSerifLao-Regular",
+  "NotoSerifMalayalam-Regular",
+  "NotoSerifMyanmar-Regular",
+  "NotoSansOriya-Regular",
+  "NotoSerifSinhala-Regular",
+  "NotoSerifTamil-Regular",
+  "NotoSerifTelugu-Regular",
+  "NotoSerifArmenian-Regular",
+  "NotoSansCanadianAboriginal-Regular",
+  "NotoSansCherokee-Regular",
+  "NotoSerifCJKjp-Regular",
+};
+static const char *kMonospaceFallbackFonts[] = {
+  "DejaVuSansMono",
+  "DejaVuSans",
+  "NotoSansSymbols-Regular",
+  "NotoNaskhArabic-Regular",
+  "NotoSansHebrew-Regular",
+  "NotoSansThai-Regular",
+  "NotoSansDevanagari-Regular",
+  "NotoSansBengali-Regular",
+  "NotoSansGujarati-Regular",
+  "NotoSansGurmukhi-Regular",
+  "NotoSansKannada-Regular",
+  "NotoSansKhmer-Regular",
+  "NotoSansLao-Regular",
+  "NotoSansMalayalam-Regular",
+  "NotoSansMyanmar-Regular",
+  "NotoSansOriya-Regular",
+  "NotoSansSinhala-Regular",
+  "NotoSansTamil-Regular",
+  "NotoSansTelugu-Regular",
+  "NotoSansArmenian-Regular",
+  "NotoSansCanadianAboriginal-Regular",
+  "NotoSansCherokee-Regular",
+  "NotoSansMonoCJKjp-Regular",
+};
+#endif
+
+struct LanguageFallbackFonts {
+  const char *serif;
+  const char *cursive;  // also used for fantasy
+  const char *sans_serif;  // also used for monospace
+};
 
-  auto klass = font_family_class();
+#ifdef __APPLE__
+static const LanguageFallbackFonts kJapaneseFallbackFonts = {"HiraMinProN-W3", "HiraMinProN-W3", "HiraKakuProN-W3"};
+static const LanguageFallbackFonts kSimplifiedChineseFallbackFonts = {"STSongti-SC-Regular", "STKaiti-SC-Regular", "STHeitiSC-Light"};
+static const LanguageFallbackFonts kTraditionalChineseFallbackFonts = {"STSongti-TC-Regular", "DFKaiShu-SB-Estd-BF", "STHeitiTC-Light"};
+static const LanguageFallbackFonts kKoreanFallbackFonts = {"AppleMyungjo", "AppleMyungjo", "AppleSDGothicNeo-Regular"};
+#else
+static const LanguageFallbackFonts kJapaneseFallbackFonts = {"NotoSerifCJKjp-Regular", "NotoSerifCJKjp-Regular", "NotoSansCJKjp-Regular"};
+static const LanguageFallbackFonts kSimplifiedChineseFallbackFonts = {"NotoSerifCJKsc-Regular", "NotoSerifCJKsc-Regular", "NotoSansCJKsc-Regular"};
+static const LanguageFallbackFonts kTraditionalChineseFallbackFonts = {"NotoSerifCJKtc-Regular", "NotoSerifCJKtc-Regular", "NotoSansCJKtc-Regular"};
+static const LanguageFallbackFonts kKoreanFallbackFonts = {"NotoSerifCJKkr-Regular", "NotoSerifCJKkr-Regular", "NotoSansCJKkr-Regular"};
+#endif
+
+static const LanguageFallbackFonts *kAllLanguageFallbackFonts[kLanguageFallbackFontsCount] = {
+  nullptr,
+  &kJapaneseFallbackFonts,
+  &kSimplifiedChineseFallbackFonts,
+  &kTraditionalChineseFallbackFonts,
+  &kKoreanFallbackFonts,
+};
 
-  const char *font_name = nullptr;
+// returns the index in kAllLanguageFallbackFonts
+static size_t GetLanguageFallbackFontsIndex(Language language) {
   if (language.language_code == MakeTag('j','a')) {
-    switch (klass) {
-      case FontFamilyClass::kSerif:
-      case FontFamilyClass::kCursive:
-      case FontFamilyClass::kFantasy:
-        font_name = "HiraMinProN-W3";
-        break;
-      default:
-        font_name = "HiraKakuProN-W3";
-        break;
-    }
+    return 1;
   }
   else if (language.language_code == MakeTag('z','h')) {
     if (language.opentype_tag == MakeTag('Z','H','S')) {
-      switch (klass) {
-        case FontFamilyClass::kSerif:
-          font_name = "STSongti-SC-Regular";
-          break;
-        case FontFamilyClass::kCursive:
-        case FontFamilyClass::kFantasy:
-          font_name = "STKaiti-SC-Regular";
-          break;
-        default:
-          font_name = "STHeitiSC-Light";
-          break;
-      }
+      return 2;
     }
     else if (language.opentype_tag == MakeTag('Z','H','T') || language.opentype_tag == MakeTag('Z','H','H')) {
-      switch (klass) {
-        case FontFamilyClass::kSerif:
-          font_name = "STSongti-TC-Regular";
-          break;
-        case FontFamilyClass::kCursive:
-        case FontFamilyClass::kFantasy:
-          font_name = "DFKaiShu-SB-Estd-BF";
-          break;
-        default:
-          font_name = "STHeitiTC-Light";
-          break;
-      }
+      return 3;
     }
   }
   else if (language.language_code == MakeTag('k','o')) {
-    switch (klass) {
-      case FontFamilyClass::kSerif:
-      case FontFamilyClass::kCursive:
-      case FontFamilyClass::kFantasy:
-        font_name = "AppleMyungjo";
-        break;
-      default:
-        font_name = "AppleSDGothicNeo-Regular";
-        break;
-    }
+    return 4;
+  }
+  return 0;
+}
+
+static const char *GetLanguageFallbackFontName(const LanguageFallbackFonts *fonts, FontFamilyClass klass) {
+  if (fonts == nullptr) {
+    return nullptr;
+  }
+  switch (klass) {
+    case FontFamilyClass::kSerif:
+      return fonts->serif;
+    case FontFamilyClass::kCursive:
+    case FontFamilyClass::kFantasy:
+      return fonts->cursive;
+    default:
+      return fonts->sans_serif;
   }
-  if (font_name) {
+}
+
+// returns nullptr when there is no more font to try
+static const char *GetFallbackFontName(size_t index, const char *language_font_name, FontFamilyClass klass) {
+  if (language_font_name != nullptr) {
     if (index == 0) {
-      return FontManager::CreateDescriptorFromPostScriptName(font_name);
+      return language_font_name;
     }
     --index;
   }
@@ -494,6 +776,11 @@ FontDescriptor FontDescriptor::GetFallback(size_t index, Language language) {
   size_t fallbacks_count;
   const char **fallbacks;
   switch (klass) {
+#ifndef __APPLE__
+    // there are no really widespread open-source cursive or fantasy fonts
+    case FontFamilyClass::kCursive:
+    case FontFamilyClass::kFantasy:
+#endif
     case FontFamilyClass::kSerif: {
       fallbacks = kSerifFallbackFonts;
       fallbacks_count = std::end(kSerifFallbackFonts) - std::begin(kSerifFallbackFonts);
@@ -504,6 +791,7 @@ FontDescriptor FontDescriptor::GetFallback(size_t index, Language language) {
       fallbacks_count = std::end(kMonospaceFallbackFonts) - std::begin(kMonospaceFallbackFonts);
       break;
     }
+#ifdef __APPLE__
     case FontFamilyClass::kCursive: {
       fallbacks = kCursiveFallbackFonts;
       fallbacks_count = std::end(kCursiveFallbackFonts) - std::begin(kCursiveFallbackFonts);
@@ -514,6 +802,7 @@ FontDescriptor FontDescriptor::GetFallback(size_t index, Language language) {
       fallbacks_count = std::end(kFantasyFallbackFonts) - std::begin(kFantasyFallbackFonts);
       break;
     }
+#endif
     default: {
       fallbacks = kSansSerifFallbackFonts;
       fallbacks_count = std::end(kSansSerifFallbackFonts) - std::begin(kSansSerifFallbackFonts);
@@ -521,36 +810,175 @@ FontDescriptor FontDescriptor::GetFallback(size_t index, Language language) {
     }
   }
   if (index < fallbacks_count) {
-    font_name = fallbacks[index];
+    return fallbacks[index];
   }
-  else if (index == fallbacks_count) {
-    font_name = ".LastResort";
+#ifdef __APPLE__
+  if (index == fallbacks_count) {
+    return ".LastResort";
   }
-  else {
-    std::abort();
+#endif
+  return nullptr;
+}
+
+FontDescriptor FontDescriptor::Data::GetFallback(size_t index, Language language) {
+  auto language_fallback_fonts_index = GetLanguageFallbackFontsIndex(language);
+  auto &chain = fallback_chains_[language_fallback_fonts_index];
+  auto font_manager = FontManager::instance();
+  if (chain.fonts_generation != font_manager->fonts_generation_) {
+    chain.fonts.clear();
+    chain.next_font_name_index = 0;
+    chain.complete = false;
+  }
+
+  if (index > chain.fonts.size() && !chain.complete) {
+    auto klass = font_family_class();
+    auto language_font_name = GetLanguageFallbackFontName(kAllLanguageFallbackFonts[language_fallback_fonts_index], klass);
+
+    // fonts that are not available are skipped, as well as the ones already tried (including this one)
+    while (index > chain.fonts.size()) {
+      auto font_name = GetFallbackFontName(chain.next_font_name_index, language_font_name, klass);
+      if (font_name == nullptr) {
+        chain.complete = true;
+        break;
+      }
+      ++chain.next_font_name_index;
+      auto fallback = FontManager::CreateDescriptorFromPostScriptName(font_name);
+      if (fallback.is_valid() && fallback.data_.get() != this && std::find(chain.fonts.begin(), chain.fonts.end(), fallback) == chain.fonts.end()) {
+        chain.fonts.push_back(fallback);
+      }
+    }
+  }
+  // taken after the fonts of the chain have been looked for, as with Core Text that can load new fonts
+  chain.fonts_generation = font_manager->fonts_generation_;
+
+  if (index > chain.fonts.size()) {
+    return {};
   }
-  return FontManager::CreateDescriptorFromPostScriptName(font_name);
+  return chain.fonts[index-1];
 }
 
+FontDescriptor FontDescriptor::GetFallback(size_t index, Language language) {
+  assert(is_valid());
+  if (index == 0) {
+    return *this;
+  }
+  return data_->GetFallback(index, language);
+}
+
+#ifdef __APPLE__
 
 FontDescriptor FontManager::CreateDescriptorFromPostScriptName(const char *name) {
+  auto font_manager = instance();
+  auto found = font_manager->fonts_by_requested_name_.find(name);
+  if (found != font_manager->fonts_by_requested_name_.end()) {
+    return found->second;
+  }
+
   auto cf_name = MakeAutoReleasedCFRef(CFStringCreateWithCString(kCFAllocatorDefault, name, kCFStringEncodingUTF8));
   auto basic_descriptor = MakeAutoReleasedCFRef(CTFontDescriptorCreateWithNameAndSize(cf_name.get(), 0.0));
 
   static const void *mandatory_attributes_values[] = { kCTFontNameAttribute };
   auto mandatory_attributes = MakeAutoReleasedCFRef(CFSetCreate(kCFAllocatorDefault, mandatory_attributes_values, sizeof(mandatory_attributes_values) / sizeof(mandatory_attributes_values[0]), nullptr));
 
-  auto font_descriptor = MakeAutoReleasedCFRef(CTFontDescriptorCreateMatchingFontDescriptor(basic_descriptor.get(), mandatory_attributes.get()));
+  auto native_font_descriptor = MakeAutoReleasedCFRef(CTFontDescriptorCreateMatchingFontDescriptor(basic_descriptor.get(), mandatory_attributes.get()));
+  FontDescriptor font_descriptor;
+  if (native_font_descriptor.get() != nullptr) {
+    font_descriptor = font_manager->Intern({std::move(native_font_descriptor)});
+  }
+  font_manager->fonts_by_requested_name_.emplace(name, font_descriptor);
+  return font_descriptor;
+}
+
+FontDescriptor FontManager::CreateDescriptorFromNativeFont(CTFontRef ct_font) {
+  auto font_descriptor = MakeAutoReleasedCFRef(CTFontCopyFontDescriptor(ct_font));
+  return instance()->Intern({std::move(font_descriptor)});
+}
+
+FontDescriptor FontManager::CreateDescriptorFromLocalFile(const char *path, int face_index) {
+  auto url = MakeAutoReleasedCFRef(CFURLCreateFromFileSystemRepresentation(kCFAllocatorDefault, reinterpret_cast<const uint8_t *>(path), strlen(path), false));
+  auto font_descriptors = MakeAutoReleasedCFRef(CTFontManagerCreateFontDescriptorsFromURL(url.get()));
+  if (font_descriptors.get() == nullptr || face_index < 0 || CFArrayGetCount(font_descriptors.get()) <= face_index) {
+    return {};
+  }
+
+  // the face itself will be found in the file mapped by MapFontFile when it is needed
+  auto font_descriptor = static_cast<CTFontDescriptorRef>(CFArrayGetValueAtIndex(font_descriptors.get(), face_index));
+  CFRetain(font_descriptor);
+  return instance()->Intern({MakeAutoReleasedCFRef(font_descriptor)});
+}
+
+FontDescriptor FontManager::CreateDescriptorFromMemory(const void *data, size_t length, int face_index) {
+  if (face_index != 0) {
+    return {};
+  }
+  auto cf_data = MakeAutoReleasedCFRef(CFDataCreateWithBytesNoCopy(kCFAllocatorDefault, static_cast<const uint8_t *>(data), CFIndex(length), kCFAllocatorNull));
+  auto font_descriptor = MakeAutoReleasedCFRef(CTFontManagerCreateFontDescriptorFromData(cf_data.get()));
   if (font_descriptor.get() == nullptr) {
     return {};
   }
+  return instance()->Intern({std::move(font_descriptor), std::make_shared<FontFile>(data, length)});
+}
+
+#else
+
+// without CoreText we can only find by PostScript name the fonts that have been loaded from a file
+FontDescriptor FontManager::CreateDescriptorFromPostScriptName(const char *name) {
+  auto font_manager = instance();
+  auto found = font_manager->fonts_by_postscript_name_.find(name);
+  if (found == font_manager->fonts_by_postscript_name_.end()) {
+    return {};
+  }
+  return found->second;
+}
+
+FontDescriptor FontManager::CreateDescriptorFromLocalFile(const char *path, int face_index) {
+  auto font_manager = instance();
+  auto font_file = font_manager->MapFontFile(path);
+  if (!font_file) {
+    return {};
+  }
+  return font_manager->CreateDescriptorFromFontFile(std::move(font_file), face_index);
+}
 
-  return {std::move(font_descriptor)};
+FontDescriptor FontManager::CreateDescriptorFromMemory(const void *data, size_t length, int face_index) {
+  return instance()->CreateDescriptorFromFontFile(std::make_shared<FontFile>(data, length), face_index);
 }
 
-FontDescriptor FontManager::CreateDescriptorFromNativeFont(CTFontRef ct_font) {
-  auto font_descriptor = MakeAutoReleasedCFRef(CTFontCopyFontDescriptor(ct_font));
-  return {std::move(font_descriptor)};
+FontDescriptor FontManager::CreateDescriptorFromFontFile(std::shared_ptr<FontFile> font_file, int face_index) {
+  // FreeType would give a face only usable to know the number of faces of the file
+  if (face_index < 0) {
+    return {};
+  }
+  auto ft_face = font_file->CreateFTFace(face_index);
+  if (ft_face == nullptr) {
+    return {};
+  }
+  // if the font had already been loaded the new face is just released
+  return Intern({std::move(font_file), ft_face});
+}
+
+#endif
+
+std::shared_ptr<FontFile> FontManager::MapFontFile(const char *path) {
+  auto &weak_font_file = font_files_[path];
+  auto font_file = weak_font_file.lock();
+  if (!font_file) {
+    font_file = FontFile::Map(path);
+    weak_font_file = font_file;
+  }
+  return font_file;
+}
+
+FontDescriptor FontManager::Intern(FontDescriptor font_descriptor) {
+  const auto &postscript_name = font_descriptor.data_->postscript_name();
+  if (postscript_name.empty()) {
+    return font_descriptor;
+  }
+  auto inserted = fonts_by_postscript_name_.emplace(postscript_name, font_descriptor);
+  if (inserted.second) {
+    ++fonts_generation_;
+  }
+  return inserted.first->second;
 }
 
 FontManager *FontManager::instance() {
@@ -561,7 +989,7 @@ FontManager *FontManager::instance() {
   return instance;
 }
 
-FontManager::FontManager() {
+FontManager::FontManager() : fonts_generation_{0} {
   auto error = FT_Init_FreeType(&ft_library_);
   assert(!error);
 }
@@ -0,0 +1,1983 @@
+// this file should only be included by grapheme_cluster.cc
+// file automatically generated by scripts/generate_grapheme_cluster_data.rb from the data of Unicode 15.0.0, do not edit
+
+enum GraphemeClusterProperty : uint8_t {
+  kOther,
+  kCR,
+  kLF,
+  kControl,
+  kExtend,
+  kExtendCombining,  // Extend with a non-zero canonical combining class (that can be inside Indic conjuncts)
+  kVirama,  // Extend that links the consonants of Indic conjuncts
+  kZWJ,
+  kRegionalIndicator,
+  kPrepend,
+  kSpacingMark,
+  kL,
+  kV,
+  kT,
+  kLV,
+  kLVT,
+  kExtendedPictographic,  // Other with the Extended_Pictographic property
+  kLinkingConsonant,  // Other that can be linked to other consonants by a virama
+};
+static const int kGraphemeClusterPropertiesCount = 18;
+
+// the properties of codepoint c are in kGraphemeClusterProperties[(kGraphemeClusterBlocks[c >> kGraphemeClusterBlockShift] << kGraphemeClusterBlockShift) + (c & (kGraphemeClusterBlockSize-1))]
+static const int kGraphemeClusterBlockShift = 7;
+static const int kGraphemeClusterBlockSize = 128;
+static const uint16_t kGraphemeClusterBlocks[] = {
+    0,   1,   2,   2,   2,   2,   3,   2,   2,   4,   2,   5,   6,   7,   8,   9,
+   10,  11,  12,  13,  14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25,
+   26,  27,  28,  29,   2,   2,  30,   2,   2,   2,   2,   2,   2,   2,  31,  32,
+   33,  34,  35,   2,  36,  37,  38,  39,  40,  41,   2,  42,   2,   2,   2,   2,
+   43,  44,  45,  46,   2,   2,  47,  48,   2,  49,   2,  50,  51,  52,  53,  54,
+    2,   2,  55,   2,   2,   2,  56,   2,   2,  57,  58,  59,   2,   2,   2,   2,
+   60,  61,   2,   2,   2,  62,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,  63,  64,   2,   2,
+   65,  66,  67,  68,  69,  70,   2,  71,  72,  73,  74,  75,  76,  77,  78,  72,
+   73,  74,  75,  76,  77,  78,  72,  73,  74,  75,  76,  77,  78,  72,  73,  74,
+   75,  76,  77,  78,  72,  73,  74,  75,  76,  77,  78,  72,  73,  74,  75,  76,
+   77,  78,  72,  73,  74,  75,  76,  77,  78,  72,  73,  74,  75,  76,  77,  78,
+   72,  73,  74,  75,  76,  77,  78,  72,  73,  74,  75,  76,  77,  78,  72,  73,
+   74,  75,  76,  77,  78,  72,  73,  74,  75,  76,  77,  78,  72,  73,  74,  79,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,  80,   2,   2,   2,   2,   2,  81,  82,   2,  83,
+    2,   2,   2,  84,   2,  85,  86,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,  87,  88,   2,   2,   2,   2,  89,   2,   2,  90,  91,  92,
+   93,  94,  95,  96,  97,  98,  99,   2, 100, 101,   2, 102, 103, 104, 105,   2,
+  106,   2, 107, 108, 109, 110,   2,   2, 111, 112, 113, 114,   2, 115, 116,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2, 117,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2, 118, 119,   2,   2,   2,   2,   2,   2,   2, 120, 121,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2, 122,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, 123,   2,
+    2,   2, 124, 125, 126,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2, 127, 128,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+  129, 130, 119,   2,   2, 131,   2,   2,   2, 132,   2,   2,   2,   2,   2,   2,
+    2, 133, 134,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+  135, 135, 136, 137, 138, 135, 135, 139, 135, 135, 140, 135, 141, 135, 142, 143,
+  144, 145, 146, 135, 135, 135,   2,   2, 135, 135, 135, 135, 135, 135, 135, 147,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+  148, 149, 150, 151, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149,
+  149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+};
+static const GraphemeClusterProperty kGraphemeClusterProperties[] = {
+  // block 0
+  kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kLF, kControl, kControl, kCR, kControl, kControl,
+  kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kControl,
+  // block 1
+  kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl,
+  kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kOther, kOther, kOther, kControl, kExtendedPictographic, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 2
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 3
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtend,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 4
+  kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 5
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kExtendCombining,
+  kOther, kExtendCombining, kExtendCombining, kOther, kExtendCombining, kExtendCombining, kOther, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 6
+  kPrepend, kPrepend, kPrepend, kPrepend, kPrepend, kPrepend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kControl, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 7
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kPrepend, kOther, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kExtendCombining, kExtendCombining, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 8
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kPrepend,
+  kOther, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 9
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kOther, kOther,
+  // block 10
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 11
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kPrepend, kPrepend, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kPrepend, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  // block 12
+  kExtend, kExtend, kExtend, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant,
+  kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant,
+  kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kExtend, kSpacingMark, kExtendCombining, kOther, kSpacingMark, kSpacingMark,
+  kSpacingMark, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kVirama, kSpacingMark, kSpacingMark,
+  kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtend, kExtend, kExtend, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant,
+  kOther, kOther, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant,
+  // block 13
+  kOther, kExtend, kSpacingMark, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant,
+  kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kOther, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant,
+  kLinkingConsonant, kOther, kLinkingConsonant, kOther, kOther, kOther, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kOther, kOther, kExtendCombining, kOther, kExtend, kSpacingMark,
+  kSpacingMark, kExtend, kExtend, kExtend, kExtend, kOther, kOther, kSpacingMark, kSpacingMark, kOther, kOther, kSpacingMark, kSpacingMark, kVirama, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kOther, kOther, kOther, kOther, kLinkingConsonant, kLinkingConsonant, kOther, kLinkingConsonant,
+  kOther, kOther, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kLinkingConsonant, kLinkingConsonant, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kOther,
+  // block 14
+  kOther, kExtend, kExtend, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kOther, kSpacingMark, kSpacingMark,
+  kSpacingMark, kExtend, kExtend, kOther, kOther, kOther, kOther, kExtend, kExtend, kOther, kOther, kExtend, kExtend, kExtendCombining, kOther, kOther,
+  kOther, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtend, kExtend, kOther, kOther, kOther, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 15
+  kOther, kExtend, kExtend, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant,
+  kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kOther, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant,
+  kLinkingConsonant, kOther, kLinkingConsonant, kLinkingConsonant, kOther, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kOther, kOther, kExtendCombining, kOther, kSpacingMark, kSpacingMark,
+  kSpacingMark, kExtend, kExtend, kExtend, kExtend, kExtend, kOther, kExtend, kExtend, kSpacingMark, kOther, kSpacingMark, kSpacingMark, kVirama, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kLinkingConsonant, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  // block 16
+  kOther, kExtend, kSpacingMark, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant,
+  kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kOther, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant,
+  kLinkingConsonant, kOther, kLinkingConsonant, kLinkingConsonant, kOther, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kOther, kOther, kExtendCombining, kOther, kExtend, kExtend,
+  kSpacingMark, kExtend, kExtend, kExtend, kExtend, kOther, kOther, kSpacingMark, kSpacingMark, kOther, kOther, kSpacingMark, kSpacingMark, kVirama, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kExtend, kExtend, kExtend, kOther, kOther, kOther, kOther, kLinkingConsonant, kLinkingConsonant, kOther, kLinkingConsonant,
+  kOther, kOther, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kLinkingConsonant, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 17
+  kOther, kOther, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kSpacingMark,
+  kExtend, kSpacingMark, kSpacingMark, kOther, kOther, kOther, kSpacingMark, kSpacingMark, kSpacingMark, kOther, kSpacingMark, kSpacingMark, kSpacingMark, kExtendCombining, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 18
+  kExtend, kSpacingMark, kSpacingMark, kSpacingMark, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant,
+  kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kOther, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant,
+  kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kOther, kOther, kExtendCombining, kOther, kExtend, kExtend,
+  kExtend, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kOther, kExtend, kExtend, kExtend, kOther, kExtend, kExtend, kExtend, kVirama, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kOther, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 19
+  kOther, kExtend, kSpacingMark, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kOther, kSpacingMark, kExtend,
+  kSpacingMark, kSpacingMark, kExtend, kSpacingMark, kSpacingMark, kOther, kExtend, kSpacingMark, kSpacingMark, kOther, kSpacingMark, kSpacingMark, kExtend, kExtendCombining, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 20
+  kExtend, kExtend, kSpacingMark, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant,
+  kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant,
+  kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kLinkingConsonant, kExtendCombining, kExtendCombining, kOther, kExtend, kSpacingMark,
+  kSpacingMark, kExtend, kExtend, kExtend, kExtend, kOther, kSpacingMark, kSpacingMark, kSpacingMark, kOther, kSpacingMark, kSpacingMark, kSpacingMark, kVirama, kPrepend, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 21
+  kOther, kExtend, kSpacingMark, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kOther, kOther, kOther, kOther, kExtend,
+  kSpacingMark, kSpacingMark, kExtend, kExtend, kExtend, kOther, kExtend, kOther, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kExtend,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kSpacingMark, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 22
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kExtend, kOther, kSpacingMark, kExtend, kExtend, kExtend, kExtend, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtend, kExtend, kExtend, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 23
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kExtend, kOther, kSpacingMark, kExtend, kExtend, kExtend, kExtend, kExtendCombining, kExtendCombining, kExtendCombining, kExtend, kExtend, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtend, kExtend, kExtend, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 24
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kExtendCombining, kOther, kExtendCombining, kOther, kExtendCombining, kOther, kOther, kOther, kOther, kSpacingMark, kSpacingMark,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kExtendCombining, kExtendCombining, kExtend, kExtendCombining, kExtend, kExtend, kExtend, kExtend, kExtend, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtend, kSpacingMark,
+  // block 25
+  kExtendCombining, kExtend, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kOther, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 26
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kExtend, kExtend,
+  kExtend, kSpacingMark, kExtend, kExtend, kExtend, kExtend, kExtend, kExtendCombining, kOther, kExtendCombining, kExtendCombining, kSpacingMark, kSpacingMark, kExtend, kExtend, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kSpacingMark, kSpacingMark, kExtend, kExtend, kOther, kOther, kOther, kOther, kExtend, kExtend,
+  kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kExtend, kExtend, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 27
+  kOther, kOther, kExtend, kOther, kSpacingMark, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 28
+  kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL,
+  kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL,
+  kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL,
+  kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL,
+  kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL,
+  kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL,
+  kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV,
+  kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV,
+  // block 29
+  kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV,
+  kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV,
+  kV, kV, kV, kV, kV, kV, kV, kV, kT, kT, kT, kT, kT, kT, kT, kT,
+  kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT,
+  kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT,
+  kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT,
+  kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT,
+  kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT,
+  // block 30
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 31
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kExtend, kExtend, kExtendCombining, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kExtend, kExtend, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 32
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kExtend, kExtend, kSpacingMark, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kSpacingMark, kSpacingMark,
+  kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kExtend, kSpacingMark, kSpacingMark, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtendCombining, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 33
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kExtend, kExtend, kControl, kExtend,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 34
+  kOther, kOther, kOther, kOther, kOther, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 35
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtend, kExtend, kExtend, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kExtend, kExtend, kSpacingMark, kSpacingMark, kSpacingMark, kOther, kOther, kOther, kOther,
+  kSpacingMark, kSpacingMark, kExtend, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 36
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kSpacingMark, kSpacingMark, kExtend, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kSpacingMark, kExtend, kSpacingMark, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kOther,
+  kExtendCombining, kOther, kExtend, kOther, kOther, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kSpacingMark, kSpacingMark, kSpacingMark,
+  kSpacingMark, kSpacingMark, kSpacingMark, kExtend, kExtend, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kExtendCombining,
+  // block 37
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtend, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 38
+  kExtend, kExtend, kExtend, kExtend, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kExtendCombining, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kSpacingMark, kExtend, kSpacingMark, kSpacingMark, kSpacingMark,
+  kSpacingMark, kSpacingMark, kExtend, kSpacingMark, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 39
+  kExtend, kExtend, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kSpacingMark, kExtend, kExtend, kExtend, kExtend, kSpacingMark, kSpacingMark, kExtend, kExtend, kSpacingMark, kExtendCombining, kExtend, kExtend, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kSpacingMark, kExtend, kExtend, kSpacingMark, kSpacingMark, kSpacingMark, kExtend, kSpacingMark, kExtend,
+  kExtend, kExtend, kSpacingMark, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 40
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kSpacingMark, kSpacingMark, kExtend, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 41
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendCombining, kExtendCombining, kExtendCombining, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kSpacingMark, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kExtendCombining, kOther, kOther,
+  kOther, kOther, kOther, kOther, kExtendCombining, kOther, kOther, kSpacingMark, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 42
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  // block 43
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kControl, kExtend, kZWJ, kControl, kControl,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 44
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtend, kExtend, kExtend,
+  kExtend, kExtendCombining, kExtend, kExtend, kExtend, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 45
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 46
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 47
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 48
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther,
+  // block 49
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 50
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kOther,
+  // block 51
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  // block 52
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  // block 53
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kOther, kExtendedPictographic, kOther, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kOther, kOther,
+  kOther, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kExtendedPictographic, kOther, kOther, kExtendedPictographic, kOther, kOther, kOther, kOther, kExtendedPictographic, kOther, kExtendedPictographic, kOther,
+  kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kOther, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 54
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 55
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 56
+  kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendedPictographic, kOther, kOther, kOther, kOther, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 57
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining,
+  kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 58
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining,
+  // block 59
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  // block 60
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 61
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 62
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kOther, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 63
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining,
+  kExtend, kExtend, kExtend, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther,
+  // block 64
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 65
+  kOther, kOther, kExtend, kOther, kOther, kOther, kExtendCombining, kOther, kOther, kOther, kOther, kExtend, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kSpacingMark, kSpacingMark, kExtend, kExtend, kSpacingMark, kOther, kOther, kOther, kOther, kExtendCombining, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 66
+  kSpacingMark, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark,
+  kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kExtendCombining, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend,
+  // block 67
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kExtend, kExtend, kExtend, kExtend, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kSpacingMark, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL,
+  kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kL, kOther, kOther, kOther,
+  // block 68
+  kExtend, kExtend, kExtend, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kExtendCombining, kSpacingMark, kSpacingMark, kExtend, kExtend, kExtend, kExtend, kSpacingMark, kSpacingMark, kExtend, kExtend, kSpacingMark, kSpacingMark,
+  kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 69
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kSpacingMark,
+  kSpacingMark, kExtend, kExtend, kSpacingMark, kSpacingMark, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kSpacingMark, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kOther, kOther, kOther,
+  // block 70
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendCombining, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining,
+  kOther, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kSpacingMark, kExtend, kExtend, kSpacingMark, kSpacingMark,
+  kOther, kOther, kOther, kOther, kOther, kSpacingMark, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 71
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kSpacingMark, kSpacingMark, kExtend, kSpacingMark, kSpacingMark, kExtend, kSpacingMark, kSpacingMark, kOther, kSpacingMark, kExtendCombining, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 72
+  kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  // block 73
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT,
+  // block 74
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  // block 75
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  // block 76
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  // block 77
+  kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  // block 78
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  // block 79
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLV, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT, kLVT,
+  kLVT, kLVT, kLVT, kLVT, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV, kV,
+  kV, kV, kV, kV, kV, kV, kV, kOther, kOther, kOther, kOther, kT, kT, kT, kT, kT,
+  kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT,
+  kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT,
+  kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kT, kOther, kOther, kOther, kOther,
+  // block 80
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 81
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 82
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kControl,
+  // block 83
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kExtend,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kOther, kOther, kOther, kOther,
+  // block 84
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kOther, kOther,
+  // block 85
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 86
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther,
+  // block 87
+  kOther, kExtend, kExtend, kExtend, kOther, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kExtend, kExtendCombining, kExtend, kExtendCombining,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kExtendCombining,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 88
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 89
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 90
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining,
+  // block 91
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 92
+  kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 93
+  kSpacingMark, kExtend, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendCombining, kOther, kOther, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining,
+  // block 94
+  kExtend, kExtend, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kSpacingMark, kSpacingMark, kSpacingMark, kExtend, kExtend, kExtend, kExtend, kSpacingMark, kSpacingMark, kExtendCombining, kExtendCombining, kOther, kOther, kPrepend, kOther, kOther,
+  kOther, kOther, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kPrepend, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 95
+  kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kExtend, kExtend, kExtend, kExtend, kSpacingMark, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kSpacingMark, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 96
+  kExtend, kExtend, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kSpacingMark, kSpacingMark, kSpacingMark, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kSpacingMark,
+  kSpacingMark, kOther, kPrepend, kPrepend, kOther, kOther, kOther, kOther, kOther, kExtend, kExtendCombining, kExtend, kExtend, kOther, kSpacingMark, kExtend,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 97
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kSpacingMark, kSpacingMark, kSpacingMark, kExtend,
+  kExtend, kExtend, kSpacingMark, kSpacingMark, kExtend, kSpacingMark, kExtendCombining, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kOther,
+  kOther, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 98
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend,
+  kSpacingMark, kSpacingMark, kSpacingMark, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 99
+  kExtend, kExtend, kSpacingMark, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kOther, kExtend, kSpacingMark,
+  kExtend, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kOther, kOther, kSpacingMark, kSpacingMark, kOther, kOther, kSpacingMark, kSpacingMark, kSpacingMark, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kSpacingMark, kSpacingMark, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 100
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kSpacingMark, kSpacingMark, kSpacingMark, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kSpacingMark, kSpacingMark, kExtendCombining, kExtend, kExtend, kSpacingMark, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 101
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtend, kSpacingMark, kSpacingMark, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kSpacingMark, kExtend, kSpacingMark, kSpacingMark, kExtend, kSpacingMark, kExtend,
+  kExtend, kSpacingMark, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 102
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend,
+  kSpacingMark, kSpacingMark, kExtend, kExtend, kExtend, kExtend, kOther, kOther, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kExtend, kExtend, kSpacingMark, kExtendCombining,
+  kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kExtend, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 103
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kSpacingMark, kSpacingMark, kSpacingMark, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kSpacingMark, kSpacingMark, kExtend, kSpacingMark, kExtendCombining,
+  kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 104
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kSpacingMark, kExtend, kSpacingMark, kSpacingMark,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kSpacingMark, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 105
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kExtend, kExtend,
+  kOther, kOther, kExtend, kExtend, kExtend, kExtend, kSpacingMark, kExtend, kExtend, kExtend, kExtend, kExtendCombining, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 106
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kSpacingMark, kSpacingMark, kSpacingMark, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kSpacingMark, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 107
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtend, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kOther, kSpacingMark, kSpacingMark, kOther, kOther, kExtend, kExtend, kSpacingMark, kExtendCombining, kPrepend,
+  kSpacingMark, kPrepend, kSpacingMark, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 108
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kSpacingMark, kSpacingMark, kSpacingMark, kExtend, kExtend, kExtend, kExtend, kOther, kOther, kExtend, kExtend, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark,
+  kExtendCombining, kOther, kOther, kOther, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 109
+  kOther, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kExtend, kExtendCombining, kExtend, kExtend, kExtend, kExtend, kSpacingMark, kPrepend, kExtend, kExtend, kExtend, kExtend, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kSpacingMark, kSpacingMark, kExtend, kExtend, kExtend, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 110
+  kOther, kOther, kOther, kOther, kPrepend, kPrepend, kPrepend, kPrepend, kPrepend, kPrepend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kSpacingMark, kExtend, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 111
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kSpacingMark,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kOther, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kSpacingMark, kExtendCombining,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 112
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kOther, kSpacingMark, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kSpacingMark, kExtend, kExtend, kSpacingMark, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 113
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kOther, kOther, kOther, kExtend, kOther, kExtend, kExtend, kOther, kExtend,
+  kExtend, kExtend, kExtendCombining, kExtend, kExtendCombining, kExtendCombining, kPrepend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 114
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kOther,
+  kExtend, kExtend, kOther, kSpacingMark, kSpacingMark, kExtend, kSpacingMark, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 115
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kExtend, kExtend, kSpacingMark, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 116
+  kExtend, kExtend, kPrepend, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kSpacingMark, kSpacingMark, kExtend, kExtend, kExtend, kExtend, kExtend, kOther, kOther, kOther, kSpacingMark, kSpacingMark,
+  kExtend, kSpacingMark, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 117
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl,
+  kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 118
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 119
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 120
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend,
+  kOther, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark,
+  kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark,
+  kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark,
+  // block 121
+  kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend,
+  kExtend, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kSpacingMark, kSpacingMark, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 122
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kExtendCombining, kOther,
+  kControl, kControl, kControl, kControl, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 123
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kOther, kOther,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 124
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kExtendCombining, kSpacingMark, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kSpacingMark, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  // block 125
+  kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 126
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 127
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kOther, kOther, kOther, kOther, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 128
+  kOther, kOther, kOther, kOther, kExtend, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kOther, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 129
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kExtendCombining, kExtendCombining, kOther, kExtendCombining, kExtendCombining, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 130
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 131
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 132
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 133
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 134
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kExtendCombining, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 135
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  // block 136
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic,
+  // block 137
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kOther,
+  kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator,
+  kRegionalIndicator, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator, kRegionalIndicator,
+  // block 138
+  kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic,
+  kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  // block 139
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtend, kExtend, kExtend, kExtend, kExtend,
+  // block 140
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  // block 141
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 142
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  // block 143
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  // block 144
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  // block 145
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther,
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  // block 146
+  kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kOther, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  // block 147
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic,
+  kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kExtendedPictographic, kOther, kOther,
+  // block 148
+  kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl,
+  kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  // block 149
+  kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl,
+  kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl,
+  kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl,
+  kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl,
+  kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl,
+  kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl,
+  kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl,
+  kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl,
+  // block 150
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  // block 151
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend, kExtend,
+  kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl, kControl,
+};
+
+enum GraphemeClusterAction : uint8_t {
+  kBreak,
+  kNoBreak,
+  kNoBreakInEmojiSequence,
+  kNoBreakInIndicConjunct,
+  kNoBreakInRegionalIndicatorPair,
+};
+#define B kBreak
+#define N kNoBreak
+#define E kNoBreakInEmojiSequence
+#define I kNoBreakInIndicConjunct
+#define R kNoBreakInRegionalIndicatorPair
+// What to do between the previous codepoint (the rows being its property) and the next one (the columns being its property).
+static const GraphemeClusterAction kGraphemeClusterActions[kGraphemeClusterPropertiesCount][kGraphemeClusterPropertiesCount] = {
+  { B,B,B,B,N,N,N,N,B,B,N,B,B,B,B,B,B,B },  // Other
+  { B,B,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // CR
+  { B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // LF
+  { B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // Control
+  { B,B,B,B,N,N,N,N,B,B,N,B,B,B,B,B,B,B },  // Extend
+  { B,B,B,B,N,N,N,N,B,B,N,B,B,B,B,B,B,I },  // ExtendCombining
+  { B,B,B,B,N,N,N,N,B,B,N,B,B,B,B,B,B,I },  // Virama
+  { B,B,B,B,N,N,N,N,B,B,N,B,B,B,B,B,E,I },  // ZWJ
+  { B,B,B,B,N,N,N,N,R,B,N,B,B,B,B,B,B,B },  // RegionalIndicator
+  { N,B,B,B,N,N,N,N,N,N,N,N,N,N,N,N,N,N },  // Prepend
+  { B,B,B,B,N,N,N,N,B,B,N,B,B,B,B,B,B,B },  // SpacingMark
+  { B,B,B,B,N,N,N,N,B,B,N,N,N,B,N,N,B,B },  // L
+  { B,B,B,B,N,N,N,N,B,B,N,B,N,N,B,B,B,B },  // V
+  { B,B,B,B,N,N,N,N,B,B,N,B,B,N,B,B,B,B },  // T
+  { B,B,B,B,N,N,N,N,B,B,N,B,N,N,B,B,B,B },  // LV
+  { B,B,B,B,N,N,N,N,B,B,N,B,B,N,B,B,B,B },  // LVT
+  { B,B,B,B,N,N,N,N,B,B,N,B,B,B,B,B,B,B },  // ExtendedPictographic
+  { B,B,B,B,N,N,N,N,B,B,N,B,B,B,B,B,B,B },  // LinkingConsonant
+};
+#undef B
+#undef N
+#undef E
+#undef I
+#undef R
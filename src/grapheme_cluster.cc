@@ -0,0 +1,149 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "grapheme_cluster.hh"
+#include "utf.hh"
+
+namespace glyphknit {
+
+#include "grapheme_cluster-data.hh"
+
+static GraphemeClusterProperty GetGraphemeClusterProperty(UChar32 c) {
+  return kGraphemeClusterProperties[(size_t(kGraphemeClusterBlocks[c >> kGraphemeClusterBlockShift]) << kGraphemeClusterBlockShift) + size_t(c & (kGraphemeClusterBlockSize-1))];
+}
+
+static void SetBit(uint64_t *bits, ssize_t index) {
+  bits[size_t(index) / 64] |= uint64_t(1) << (size_t(index) % 64);
+}
+
+// sets the bits from start_index (included) to end_index (excluded)
+static void SetBits(uint64_t *bits, ssize_t start_index, ssize_t end_index) {
+  auto start_word_index = size_t(start_index) / 64, end_word_index = size_t(end_index) / 64;
+  auto start_mask = ~uint64_t(0) << (size_t(start_index) % 64), end_mask = ~(~uint64_t(0) << (size_t(end_index) % 64));
+  if (start_word_index == end_word_index) {
+    bits[start_word_index] |= start_mask & end_mask;
+    return;
+  }
+  bits[start_word_index] |= start_mask;
+  for (auto word_index = start_word_index + 1; word_index < end_word_index; ++word_index) {
+    bits[word_index] = ~uint64_t(0);
+  }
+  if (end_mask != 0) {
+    bits[end_word_index] |= end_mask;
+  }
+}
+
+// code units that are always a grapheme cluster by themselves when what is before them does not attach to them (so not after a CR, a Prepend or a ZWJ),
+// most text being only made of them (the generation script checks that all codepoints before U+0300 but CR are Other, Control, LF or Extended_Pictographic)
+static bool IsSimpleCodeUnit(uint16_t c) {
+  if (c < 0x300) {
+    return c != '\r';
+  }
+  return !U16_IS_SURROGATE(c) && GetGraphemeClusterProperty(c) == kOther;
+}
+
+void FindGraphemeClusterBoundaries(const uint16_t *text, ssize_t length, uint64_t *bits) {
+  SetBit(bits, 0);  // GB1
+  if (length == 0) {
+    return;
+  }
+
+  ssize_t index = 0;
+  auto previous_property = GetGraphemeClusterProperty(ConsumeCodepoint(text, length, index));
+  // 1 after "ExtendedPictographic Extend*", 2 after "ExtendedPictographic Extend* ZWJ" (for GB11)
+  int emoji_state = (previous_property == kExtendedPictographic ? 1 : 0);
+  // 1 after "LinkingConsonant (ExtendCombining | ZWJ)*", 2 after "LinkingConsonant (ExtendCombining | ZWJ)* Virama (ExtendCombining | Virama | ZWJ)*" (for ICU's Indic conjuncts)
+  int conjunct_state = (previous_property == kLinkingConsonant ? 1 : 0);
+  int regional_indicators_count = (previous_property == kRegionalIndicator ? 1 : 0);  // in a row (for GB12 and GB13)
+
+  while (index < length) {
+    if (previous_property != kCR && previous_property != kPrepend && previous_property != kZWJ && IsSimpleCodeUnit(text[index])) {
+      auto run_end_index = index + 1;
+      while (run_end_index < length && IsSimpleCodeUnit(text[run_end_index])) {
+        ++run_end_index;
+      }
+      if (run_end_index - index >= 2) {
+        // a boundary before each code unit of the run, the last one being handled below to know what can attach to it
+        SetBits(bits, index, run_end_index - 1);
+        index = run_end_index - 1;
+        previous_property = kControl;  // nothing attaches to a simple code unit
+      }
+    }
+
+    auto codepoint_start_index = index;
+    auto property = GetGraphemeClusterProperty(ConsumeCodepoint(text, length, index));
+    auto action = kGraphemeClusterActions[previous_property][property];
+    bool is_break;
+    switch (action) {
+      case kNoBreakInEmojiSequence:
+        is_break = (emoji_state != 2);
+        break;
+      case kNoBreakInIndicConjunct:
+        is_break = (conjunct_state != 2);
+        break;
+      case kNoBreakInRegionalIndicatorPair:
+        is_break = (regional_indicators_count % 2 == 0);
+        break;
+      default:
+        is_break = (action == kBreak);
+        break;
+    }
+    bits[size_t(codepoint_start_index) / 64] |= uint64_t(is_break) << (size_t(codepoint_start_index) % 64);
+
+    switch (property) {
+      case kExtendedPictographic:
+        emoji_state = 1;
+        conjunct_state = 0;
+        break;
+      case kLinkingConsonant:
+        emoji_state = 0;
+        conjunct_state = 1;
+        break;
+      case kExtend:
+        emoji_state = (emoji_state == 1 ? 1 : 0);
+        conjunct_state = 0;
+        break;
+      case kExtendCombining:
+        emoji_state = (emoji_state == 1 ? 1 : 0);
+        break;
+      case kVirama:
+        emoji_state = (emoji_state == 1 ? 1 : 0);
+        conjunct_state = (conjunct_state != 0 ? 2 : 0);
+        break;
+      case kZWJ:
+        emoji_state = (emoji_state == 1 ? 2 : 0);
+        break;
+      default:
+        emoji_state = 0;
+        conjunct_state = 0;
+        break;
+    }
+    regional_indicators_count = (property == kRegionalIndicator ? regional_indicators_count + 1 : 0);
+    previous_property = property;
+  }
+
+  SetBit(bits, length);  // GB2
+}
+
+}
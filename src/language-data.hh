@@ -1,7 +1,9 @@
 // this file should only be included by language.cc
 // file automatically generated by scripts/generate_language_data.rb, do not edit
 
-static_assert(USCRIPT_CODE_LIMIT <= 167, "USCRIPT_CODE_LIMIT is bigger than expected. You need to regenerate language-data.hh with the version of ICU you are using.");
+// The system's ICU might be more recent than the one used to generate this file (for example on Linux).
+// Scripts added since are handled as if we had no information about them.
+static const int kKnownScriptsCount = 167;
 // The language text from a script is most likely to be in if you don't have any other information.
 // The indices of kLikelyLanguageForScripts are USCRIPT_ values.
 // Note that most of the unknowns are for scripts we don't care about here as they are never used as Unicode properties.
@@ -22,13 +22,17 @@
  * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
  */
 
-#include "autorelease.hh"
 #include "language.hh"
 
-#include <CoreFoundation/CoreFoundation.h>
-
+#include <algorithm>
+#include <cassert>
 #include <cstdio>
+#include <cstdlib>
 #include <vector>
+#ifdef __APPLE__
+#include "autorelease.hh"
+#include <CoreFoundation/CoreFoundation.h>
+#endif
 
 namespace glyphknit {
 
@@ -57,7 +61,7 @@ bool AreStringEqualCaseInsensitive(const char *str1, const char *str2, int lengt
 
 static
 bool IsScriptValid(UScriptCode script) {
-  return (script >= 0 && script < USCRIPT_CODE_LIMIT);
+  return (script >= 0 && script < USCRIPT_CODE_LIMIT && script < kKnownScriptsCount);
 }
 
 Language GetPredominantLanguageForScript(UScriptCode script) {
@@ -168,6 +172,7 @@ const PreferredLanguages &GetPreferredLanguages() {
 
   auto new_preferred_languages = new PreferredLanguages{};
 
+#ifdef __APPLE__
   auto system_preferred_languages = MakeAutoReleasedCFRef(CFLocaleCopyPreferredLanguages());
   assert(system_preferred_languages.get() != nullptr);
   auto count = CFArrayGetCount(system_preferred_languages.get());
@@ -180,6 +185,24 @@ const PreferredLanguages &GetPreferredLanguages() {
       new_preferred_languages->push_back(FindLanguageCodeAndOpenTypeLanguageTag(buffer));
     }
   }
+#else
+  // LANGUAGE is a list of languages separated by colons, for example "ja_JP:en"
+  auto language_variable = std::getenv("LANGUAGE");
+  if (language_variable != nullptr) {
+    auto language_start = language_variable;
+    for (;;) {
+      auto language_end = std::strchr(language_start, ':');
+      ssize_t length = (language_end == nullptr ? std::strlen(language_start) : language_end - language_start);
+      if (length > 0) {
+        new_preferred_languages->push_back(FindLanguageCodeAndOpenTypeLanguageTag(language_start, length));
+      }
+      if (language_end == nullptr) {
+        break;
+      }
+      language_start = language_end + 1;
+    }
+  }
+#endif
 
   preferred_languages = new_preferred_languages;
   return *preferred_languages;
@@ -0,0 +1,226 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "layout_session.hh"
+#include "newline.hh"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iterator>
+
+namespace glyphknit {
+
+LayoutSession::LayoutSession(Typesetter &typesetter, TextBlock &text_block) : typesetter_(typesetter), text_block_(text_block), lines_count_(0), available_width_(0), laid_out_(false), optimal_line_breaking_(nullptr), balanced_line_breaking_(false) {
+  // everything will be laid out on the first update anyway
+  text_block.ClearChanges();
+  ApplyChange(TextBlock::Change{0, 0, text_block.text_length()});
+}
+
+// replaces the paragraphs touched by the change by the ones now in the text (that have to be laid out)
+LayoutSession::ChangedParagraphs LayoutSession::ApplyChange(const TextBlock::Change &change) {
+  auto ParagraphContaining = [this](ssize_t index) {
+    // the paragraph separator is part of the paragraph
+    auto following_paragraph = std::upper_bound(paragraphs_.begin(), paragraphs_.end(), index, [](ssize_t text_index, const Paragraph &paragraph) {
+      return text_index < paragraph.start_index;
+    });
+    return following_paragraph == paragraphs_.begin() ? following_paragraph : std::prev(following_paragraph);
+  };
+  // the character before the change is included as the change might make it part of a paragraph separator (CR followed by LF)
+  auto first_paragraph = ParagraphContaining(std::max(change.start - 1, ssize_t(0)));
+  auto end_paragraph = ParagraphContaining(change.old_end);
+  if (end_paragraph != paragraphs_.end()) {
+    ++end_paragraph;
+  }
+
+  ChangedParagraphs changed_paragraphs{
+    .first_paragraph_index = size_t(first_paragraph - paragraphs_.begin()),
+    .end_paragraph_index = 0,
+    .old_lines_count = 0,
+  };
+  for (auto paragraph = first_paragraph; paragraph != end_paragraph; ++paragraph) {
+    changed_paragraphs.old_lines_count += paragraph->typeset_lines.size();
+  }
+
+  auto delta = change.new_end - change.old_end;
+  ssize_t rescan_start_index = (first_paragraph == paragraphs_.end() ? 0 : first_paragraph->start_index);
+  // the paragraphs following the change do not change, they just move
+  ssize_t rescan_end_index = (end_paragraph == paragraphs_.end() ? text_block_.text_length() : end_paragraph->start_index + delta);
+  std::vector<Paragraph> new_paragraphs;
+  ParagraphIterator paragraph_iterator{text_block_.text_content(), rescan_start_index, text_block_.text_length()};
+  for (auto range = paragraph_iterator.FindNext(); range.start < rescan_end_index; range = paragraph_iterator.FindNext()) {
+    new_paragraphs.push_back(Paragraph{
+      .start_index = range.start,
+      .end_index = range.end,
+      .needs_shaping = true,
+    });
+    // the new paragraphs get the layout of the previous ones in the same order, most changes being inside a paragraph
+    auto previous_paragraph = first_paragraph + ssize_t(new_paragraphs.size() - 1);
+    if (previous_paragraph < end_paragraph) {
+      auto &new_paragraph = new_paragraphs.back();
+      new_paragraph.shaped_paragraph = std::move(previous_paragraph->shaped_paragraph);
+      new_paragraph.lines = std::move(previous_paragraph->lines);
+      new_paragraph.typeset_lines = std::move(previous_paragraph->typeset_lines);
+    }
+  }
+
+  auto first_paragraph_index = changed_paragraphs.first_paragraph_index;
+  auto new_end_paragraph = paragraphs_.erase(first_paragraph, end_paragraph);
+  new_end_paragraph = paragraphs_.insert(new_end_paragraph, std::make_move_iterator(new_paragraphs.begin()), std::make_move_iterator(new_paragraphs.end())) + new_paragraphs.size();
+  for (auto paragraph = new_end_paragraph; paragraph != paragraphs_.end(); ++paragraph) {
+    paragraph->start_index += delta;
+    paragraph->end_index += delta;
+  }
+  assert(new_end_paragraph == paragraphs_.end() || new_end_paragraph->start_index == rescan_end_index);
+  changed_paragraphs.end_paragraph_index = first_paragraph_index + new_paragraphs.size();
+  lines_count_ -= changed_paragraphs.old_lines_count;
+  return changed_paragraphs;
+}
+
+TypesetLines LayoutSession::PositionLines(const Paragraph &paragraph, const ShapedParagraph &shaped_paragraph, const ShapedParagraph::Lines &lines) {
+  auto typeset_lines = typesetter_.PositionLines(text_block_, shaped_paragraph, lines);
+  for (auto &line : typeset_lines) {
+    for (auto &run : line.runs) {
+      for (auto &glyph : run.glyphs) {
+        glyph.offset -= paragraph.start_index;
+      }
+    }
+  }
+  return typeset_lines;
+}
+
+LayoutSession::ChangedLines LayoutSession::LayOutParagraph(Paragraph &paragraph, bool break_all_lines) {
+  size_t previous_lines_count = paragraph.typeset_lines.size();
+  // only the greedy line breaking can break again just the lines around a change
+  if (!paragraph.needs_shaping || break_all_lines || paragraph.lines.empty() || !typesetter_.breaks_lines_greedily()) {
+    if (paragraph.needs_shaping) {
+      paragraph.shaped_paragraph = typesetter_.ShapeParagraph(text_block_, paragraph.start_index, paragraph.end_index);
+      paragraph.needs_shaping = false;
+    }
+    else {
+      paragraph.shaped_paragraph.MoveTo(paragraph.start_index);
+    }
+    paragraph.lines = typesetter_.BreakLines(text_block_, paragraph.shaped_paragraph, available_width_);
+    paragraph.typeset_lines = PositionLines(paragraph, paragraph.shaped_paragraph, paragraph.lines);
+    return ChangedLines{0, previous_lines_count, paragraph.typeset_lines.size()};
+  }
+
+  // only the lines around the change are broken again
+  auto shaped_paragraph = typesetter_.ShapeParagraph(text_block_, paragraph.start_index, paragraph.end_index);
+  paragraph.needs_shaping = false;
+  auto start_index_delta = paragraph.start_index - paragraph.shaped_paragraph.start_index();
+  paragraph.shaped_paragraph.MoveTo(paragraph.start_index);
+  for (auto &line : paragraph.lines) {
+    line.start_index += start_index_delta;
+    line.end_index += start_index_delta;
+  }
+  ShapedParagraph::Reflow reflow;
+  auto lines = typesetter_.BreakLinesAgain(text_block_, shaped_paragraph, available_width_, paragraph.shaped_paragraph, paragraph.lines, &reflow);
+  auto new_typeset_lines = PositionLines(paragraph, shaped_paragraph, ShapedParagraph::Lines(lines.begin() + ssize_t(reflow.first_line_index), lines.begin() + ssize_t(reflow.end_line_index)));
+
+  auto &typeset_lines = paragraph.typeset_lines;
+  for (auto line = typeset_lines.begin() + ssize_t(reflow.previous_end_line_index); line != typeset_lines.end(); ++line) {
+    for (auto &run : line->runs) {
+      run.bidi_visual_index += reflow.bidi_visual_index_delta;
+      for (auto &glyph : run.glyphs) {
+        glyph.offset += reflow.index_delta;
+      }
+    }
+  }
+  auto replaced_lines = typeset_lines.erase(typeset_lines.begin() + ssize_t(reflow.first_line_index), typeset_lines.begin() + ssize_t(reflow.previous_end_line_index));
+  typeset_lines.insert(replaced_lines, std::make_move_iterator(new_typeset_lines.begin()), std::make_move_iterator(new_typeset_lines.end()));
+  paragraph.shaped_paragraph = std::move(shaped_paragraph);
+  paragraph.lines = std::move(lines);
+  return ChangedLines{reflow.first_line_index, reflow.previous_end_line_index - reflow.first_line_index, reflow.end_line_index - reflow.first_line_index};
+}
+
+LayoutSession::ChangedLines LayoutSession::Update(double available_width) {
+  ChangedParagraphs changed_paragraphs{0, 0, 0};
+  const auto &changes = text_block_.changes();
+  if (!changes.empty()) {
+    auto change = changes.front();
+    for (auto other_change = changes.begin() + 1; other_change != changes.end(); ++other_change) {
+      change = change.FollowedBy(*other_change);
+    }
+    text_block_.ClearChanges();
+    changed_paragraphs = ApplyChange(change);
+  }
+  bool width_changed = (!laid_out_ || std::islessgreater(available_width, available_width_));
+  bool line_breaking_changed = (typesetter_.optimal_line_breaking() != optimal_line_breaking_ || typesetter_.balanced_line_breaking() != balanced_line_breaking_);
+  bool break_all_lines = (width_changed || line_breaking_changed);
+  if (break_all_lines) {
+    available_width_ = available_width;
+    laid_out_ = true;
+    optimal_line_breaking_ = typesetter_.optimal_line_breaking();
+    balanced_line_breaking_ = typesetter_.balanced_line_breaking();
+    changed_paragraphs = ChangedParagraphs{
+      .first_paragraph_index = 0,
+      .end_paragraph_index = paragraphs_.size(),
+      .old_lines_count = lines_count_ + changed_paragraphs.old_lines_count,
+    };
+    lines_count_ = 0;
+  }
+
+  // the lines that changed go from the first changed line of the first paragraph laid out to the last changed line of the last one
+  ChangedLines changed_lines{0, changed_paragraphs.old_lines_count, 0};
+  for (size_t paragraph_index = 0; paragraph_index < changed_paragraphs.first_paragraph_index; ++paragraph_index) {
+    changed_lines.start_line_index += paragraphs_[paragraph_index].typeset_lines.size();
+  }
+  size_t same_first_lines_count = 0;
+  size_t same_last_lines_count = 0;
+  for (size_t paragraph_index = changed_paragraphs.first_paragraph_index; paragraph_index < changed_paragraphs.end_paragraph_index; ++paragraph_index) {
+    auto &paragraph = paragraphs_[paragraph_index];
+    auto paragraph_changed_lines = LayOutParagraph(paragraph, break_all_lines);
+    if (paragraph_index == changed_paragraphs.first_paragraph_index) {
+      same_first_lines_count = paragraph_changed_lines.start_line_index;
+    }
+    same_last_lines_count = paragraph.typeset_lines.size() - paragraph_changed_lines.start_line_index - paragraph_changed_lines.new_lines_count;
+    changed_lines.new_lines_count += paragraph.typeset_lines.size();
+  }
+  lines_count_ += changed_lines.new_lines_count;
+  if (changed_lines.new_lines_count > 0) {
+    changed_lines.start_line_index += same_first_lines_count;
+    changed_lines.old_lines_count -= same_first_lines_count + same_last_lines_count;
+    changed_lines.new_lines_count -= same_first_lines_count + same_last_lines_count;
+  }
+  return changed_lines;
+}
+
+TypesetLines LayoutSession::AllLines() const {
+  TypesetLines typeset_lines;
+  typeset_lines.reserve(lines_count_);
+  for (const auto &paragraph : paragraphs_) {
+    for (const auto &line : paragraph.typeset_lines) {
+      typeset_lines.push_back(line);
+      for (auto &run : typeset_lines.back().runs) {
+        for (auto &glyph : run.glyphs) {
+          glyph.offset += paragraph.start_index;
+        }
+      }
+    }
+  }
+  return typeset_lines;
+}
+
+}
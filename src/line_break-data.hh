@@ -0,0 +1,2520 @@
+// this file should only be included by line_break.cc
+// file automatically generated by scripts/generate_line_break_data.rb from the data of Unicode 15.0.0, do not edit
+
+enum LineBreakClass : uint8_t {
+  kBK,
+  kCR,
+  kLF,
+  kNL,
+  kSP,
+  kZW,
+  kZWJ,
+  kCM,
+  kWJ,
+  kGL,
+  kBA,
+  kHY,
+  kBB,
+  kB2,
+  kCB,
+  kNS,
+  kEX,
+  kIS,
+  kSY,
+  kCL,
+  kCP,
+  kCPEastAsian,  // CP with an East Asian width of F, W or H (not concerned by rule LB30)
+  kOP,
+  kOPEastAsian,  // OP with an East Asian width of F, W or H (not concerned by rule LB30)
+  kQU,
+  kIN,
+  kNU,
+  kPR,
+  kPO,
+  kAL,
+  kHL,
+  kID,
+  kIDUnassignedPictographic,  // unassigned Extended_Pictographic codepoints (rule LB30b)
+  kEB,
+  kEM,
+  kJL,
+  kJV,
+  kJT,
+  kH2,
+  kH3,
+  kRI,
+  kSA,
+};
+static const int kLineBreakClassesCount = 42;
+
+// the classes of codepoint c are in kLineBreakClasses[(kLineBreakBlocks[c >> kLineBreakBlockShift] << kLineBreakBlockShift) + (c & (kLineBreakBlockSize-1))]
+static const int kLineBreakBlockShift = 7;
+static const int kLineBreakBlockSize = 128;
+static const uint16_t kLineBreakBlocks[] = {
+    0,   1,   2,   2,   2,   3,   4,   2,   2,   5,   2,   6,   7,   8,   9,  10,
+   11,  12,  13,  14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,
+   27,  28,  29,  30,   2,   2,  31,   2,  32,   2,   2,   2,   2,  33,  34,  35,
+   36,  37,  38,  39,  40,  41,  42,  43,  44,  45,   2,  46,   2,   2,   2,  47,
+   48,  49,  50,   2,  51,  52,  53,  54,   2,   2,   2,   2,  55,  56,  57,  58,
+    2,   2,   2,  59,   2,   2,   2,   2,   2,  60,  61,  62,  63,  64,  65,  66,
+   67,  68,  69,  70,  71,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  72,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   73,  65,  65,  65,  65,  65,  65,  65,  65,  74,   2,   2,  75,  76,   2,   2,
+   77,  78,  79,  80,  81,  82,   2,  83,  84,  85,  86,  87,  88,  89,  90,  84,
+   85,  86,  87,  88,  89,  90,  84,  85,  86,  87,  88,  89,  90,  84,  85,  86,
+   87,  88,  89,  90,  84,  85,  86,  87,  88,  89,  90,  84,  85,  86,  87,  88,
+   89,  90,  84,  85,  86,  87,  88,  89,  90,  84,  85,  86,  87,  88,  89,  90,
+   84,  85,  86,  87,  88,  89,  90,  84,  85,  86,  87,  88,  89,  90,  84,  85,
+   86,  87,  88,  89,  90,  84,  85,  86,  87,  88,  89,  90,  84,  85,  86,  91,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,  65,  65,  65,  65,  92,   2,   2,   2,  93,  94,  95,  96,  97,  98,
+    2,   2,  99, 100,   2, 101, 102, 103,   2, 104,   2,   2,   2,   2,   2,   2,
+  105,   2, 106,   2, 107, 108, 109,   2,   2,   2, 110,   2,   2, 111, 112, 113,
+  114, 115, 116, 117, 118, 119, 120,   2, 121, 122,   2, 123, 124, 125, 126,   2,
+  127, 128, 129, 130, 131, 132, 133,   2, 134, 135, 136, 137,   2, 138, 139, 140,
+    2,   2,   2,   2,   2,   2,   2,   2, 141,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2, 142, 143, 144,   2, 145,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, 146,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2, 147, 148, 149,   2,   2,   2,   2,   2,   2, 150, 151, 152,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65, 153,
+   65,  65,  65,  65,  65,  65,   2,   2,   2,   2, 154,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+   65,  65, 155,  65,  65, 156,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2, 157,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, 158,   2,
+    2,   2, 159, 160, 161,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, 162,
+    2,   2,   2,   2, 163, 164,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+  165, 166, 167,   2,   2, 168,   2,   2,   2, 169,   2,   2,   2,   2,   2,   2,
+    2, 170, 171,   2,   2,   2,   2,   2,   2, 172,   2,   2,   2,   2,   2,   2,
+  173, 174, 175, 176, 177, 178,  65, 179, 180, 181, 182, 183, 184, 185, 186, 187,
+  188, 189, 190, 191, 192, 193,   2, 194, 178, 178, 178, 178, 178, 178, 178, 195,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65, 196,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,
+   65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65,  65, 196,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+  197,   2, 198, 199,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+};
+static const LineBreakClass kLineBreakClasses[] = {
+  // block 0
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kBA, kLF, kBK, kBK, kCR, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kSP, kEX, kQU, kAL, kPR, kPO, kAL, kQU, kOP, kCP, kAL, kPR, kIS, kHY, kIS, kSY,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kIS, kIS, kAL, kAL, kAL, kEX,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kOP, kPR, kCP, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kOP, kBA, kCL, kAL, kCM,
+  // block 1
+  kCM, kCM, kCM, kCM, kCM, kNL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kGL, kOP, kPO, kPR, kPR, kPR, kAL, kAL, kAL, kAL, kAL, kQU, kAL, kBA, kAL, kAL,
+  kPO, kPR, kAL, kAL, kBB, kAL, kAL, kAL, kAL, kAL, kAL, kQU, kAL, kAL, kAL, kOP,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 2
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 3
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kBB, kAL, kAL, kAL, kBB, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kBB,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 4
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kGL,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kGL, kGL, kGL, kGL,
+  kGL, kGL, kGL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kIS, kAL,
+  // block 5
+  kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 6
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kIS, kBA, kAL, kAL, kAL, kAL, kPR,
+  kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kBA, kCM,
+  kAL, kCM, kCM, kAL, kCM, kCM, kEX, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kHL, kHL, kHL, kHL, kHL, kHL, kHL, kHL, kHL, kHL, kHL, kHL, kHL, kHL, kHL, kHL,
+  kHL, kHL, kHL, kHL, kHL, kHL, kHL, kHL, kHL, kHL, kHL, kAL, kAL, kAL, kAL, kHL,
+  kHL, kHL, kHL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 7
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kPO, kPO, kPO, kIS, kIS, kAL, kAL,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kEX, kCM, kEX, kEX, kEX,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kPO, kNU, kNU, kAL, kAL, kAL,
+  kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 8
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kEX, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kCM,
+  kCM, kCM, kCM, kCM, kCM, kAL, kAL, kCM, kCM, kAL, kCM, kCM, kCM, kCM, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 9
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 10
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kIS, kEX, kAL, kAL, kAL, kCM, kPR, kPR,
+  // block 11
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kAL, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kAL, kCM, kCM, kCM, kAL, kCM, kCM, kCM, kCM, kCM, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 12
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  // block 13
+  kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kAL, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kCM, kCM, kBA, kBA, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 14
+  kAL, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kAL, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kAL, kAL, kCM, kCM, kAL, kAL, kCM, kCM, kCM, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kCM, kCM, kAL, kAL, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU,
+  kAL, kAL, kPO, kPO, kAL, kAL, kAL, kAL, kAL, kPO, kAL, kPR, kAL, kAL, kCM, kAL,
+  // block 15
+  kAL, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kAL, kCM, kCM,
+  kCM, kCM, kCM, kAL, kAL, kAL, kAL, kCM, kCM, kAL, kAL, kCM, kCM, kCM, kAL, kAL,
+  kAL, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU,
+  kCM, kCM, kAL, kAL, kAL, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 16
+  kAL, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kAL, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kAL, kCM, kCM, kCM, kAL, kCM, kCM, kCM, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kCM, kCM, kAL, kAL, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU,
+  kAL, kPR, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM,
+  // block 17
+  kAL, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kAL, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kAL, kAL, kCM, kCM, kAL, kAL, kCM, kCM, kCM, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kCM, kCM, kAL, kAL, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 18
+  kAL, kAL, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM,
+  kCM, kCM, kCM, kAL, kAL, kAL, kCM, kCM, kCM, kAL, kCM, kCM, kCM, kCM, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kPR, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 19
+  kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kAL, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kAL, kCM, kCM, kCM, kAL, kCM, kCM, kCM, kCM, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kCM, kCM, kAL, kAL, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kBB, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 20
+  kAL, kCM, kCM, kCM, kBB, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kAL, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kAL, kCM, kCM, kCM, kAL, kCM, kCM, kCM, kCM, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kCM, kCM, kAL, kAL, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU,
+  kAL, kAL, kAL, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 21
+  kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kAL, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kAL, kCM, kCM, kCM, kAL, kCM, kCM, kCM, kCM, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kCM, kCM, kAL, kAL, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kPO, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 22
+  kAL, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kAL, kAL, kAL, kAL, kCM,
+  kCM, kCM, kCM, kCM, kCM, kAL, kCM, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kAL, kAL, kAL, kAL, kAL, kAL, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU,
+  kAL, kAL, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 23
+  kAL, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kAL, kAL, kAL, kAL, kPR,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kBA, kBA, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 24
+  kAL, kSA, kSA, kAL, kSA, kAL, kSA, kSA, kSA, kSA, kSA, kAL, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kAL, kSA, kAL, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kAL, kAL,
+  kSA, kSA, kSA, kSA, kSA, kAL, kSA, kAL, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kSA, kSA, kSA, kSA,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 25
+  kAL, kBB, kBB, kBB, kBB, kAL, kBB, kBB, kGL, kBB, kBB, kBA, kGL, kEX, kEX, kEX,
+  kEX, kEX, kGL, kAL, kEX, kAL, kAL, kAL, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kBA, kCM, kAL, kCM, kAL, kCM, kOP, kCL, kOP, kCL, kCM, kCM,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kBA,
+  // block 26
+  kCM, kCM, kCM, kCM, kCM, kBA, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kBA, kBA,
+  kAL, kAL, kAL, kAL, kAL, kAL, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kBB, kBB, kBA, kBB, kAL, kAL, kAL, kAL, kAL, kGL, kGL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 27
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kBA, kBA, kAL, kAL, kAL, kAL,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  // block 28
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kSA, kSA, kSA, kSA, kSA, kSA,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 29
+  kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL,
+  kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL,
+  kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL,
+  kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL,
+  kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL,
+  kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL,
+  kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV,
+  kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV,
+  // block 30
+  kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV,
+  kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV,
+  kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT,
+  kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT,
+  kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT,
+  kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT,
+  kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT,
+  kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT,
+  // block 31
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM,
+  kAL, kBA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 32
+  kBA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 33
+  kBA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kOP, kCL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kBA, kBA, kBA, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 34
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kCM, kCM, kCM, kBA, kBA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 35
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kBA, kBA, kNS, kSA, kBA, kAL, kBA, kPR, kSA, kSA, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 36
+  kAL, kAL, kEX, kEX, kBA, kBA, kBB, kAL, kEX, kEX, kAL, kCM, kCM, kCM, kGL, kCM,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 37
+  kAL, kAL, kAL, kAL, kAL, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 38
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kEX, kEX, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kAL, kAL,
+  kSA, kSA, kSA, kSA, kSA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 39
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kAL, kAL, kAL, kAL,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kSA, kAL, kAL, kAL, kSA, kSA,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 40
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kAL,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kAL, kAL, kCM,
+  // block 41
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kAL, kAL,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 42
+  kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kBA, kBA, kAL, kBA, kBA, kBA,
+  kBA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kBA, kBA, kAL,
+  // block 43
+  kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 44
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kBA, kBA, kBA, kBA, kBA,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kBA, kBA,
+  // block 45
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kCM, kCM, kCM, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kCM, kAL, kAL,
+  kAL, kAL, kAL, kAL, kCM, kAL, kAL, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 46
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kGL, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kGL, kCM, kCM, kCM,
+  // block 47
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kBB, kAL, kAL,
+  // block 48
+  kBA, kBA, kBA, kBA, kBA, kBA, kBA, kGL, kBA, kBA, kBA, kZW, kCM, kZWJ, kCM, kCM,
+  kBA, kGL, kBA, kBA, kB2, kAL, kAL, kAL, kQU, kQU, kOP, kQU, kQU, kQU, kOP, kQU,
+  kAL, kAL, kAL, kAL, kIN, kIN, kIN, kBA, kBK, kBK, kCM, kCM, kCM, kCM, kCM, kGL,
+  kPO, kPO, kPO, kPO, kPO, kPO, kPO, kPO, kAL, kQU, kQU, kAL, kNS, kNS, kAL, kAL,
+  kAL, kAL, kAL, kAL, kIS, kOP, kCL, kNS, kNS, kNS, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kBA, kPO, kBA, kBA, kBA, kBA, kAL, kBA, kBA, kBA,
+  kWJ, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kOP, kCL, kAL,
+  // block 49
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kOP, kCL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kPR, kPR, kPR, kPR, kPR, kPR, kPR, kPO, kPR, kPR, kPR, kPR, kPR, kPR, kPR, kPR,
+  kPR, kPR, kPR, kPR, kPR, kPR, kPO, kPR, kPR, kPR, kPR, kPO, kPR, kPR, kPO, kPR,
+  kPO, kPR, kPR, kPR, kPR, kPR, kPR, kPR, kPR, kPR, kPR, kPR, kPR, kPR, kPR, kPR,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 50
+  kAL, kAL, kAL, kPO, kAL, kAL, kAL, kAL, kAL, kPO, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kPR, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 51
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kPR, kPR, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 52
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kIN,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 53
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kOP, kCL, kOP, kCL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kID, kID, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kOPEastAsian, kCL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 54
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kID, kID, kID, kID, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 55
+  kID, kID, kID, kID, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kID, kID, kAL, kAL, kID, kAL, kID, kID, kID, kEB, kID, kID,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kID, kID, kID, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kID, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kID,
+  // block 56
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kAL, kAL, kAL, kAL, kID, kAL, kID,
+  kID, kID, kAL, kID, kID, kAL, kAL, kAL, kID, kID, kAL, kAL, kID, kAL, kAL, kID,
+  kID, kID, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kID, kAL, kAL, kAL, kAL, kAL,
+  kAL, kID, kID, kID, kID, kID, kAL, kID, kID, kEB, kID, kAL, kAL, kID, kID, kID,
+  // block 57
+  kID, kID, kID, kID, kID, kAL, kAL, kAL, kID, kID, kEB, kEB, kEB, kEB, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kQU, kQU, kQU, kQU, kQU,
+  kQU, kAL, kEX, kEX, kID, kAL, kAL, kAL, kOP, kCL, kOP, kCL, kOP, kCL, kOP, kCL,
+  kOP, kCL, kOP, kCL, kOP, kCL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 58
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kOP, kCL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kOP, kCL, kOP, kCL, kOP, kCL, kOP, kCL, kOP, kCL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 59
+  kAL, kAL, kAL, kOP, kCL, kOP, kCL, kOP, kCL, kOP, kCL, kOP, kCL, kOP, kCL, kOP,
+  kCL, kOP, kCL, kOP, kCL, kOP, kCL, kOP, kCL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kOP, kCL, kOP, kCL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kOP, kCL, kAL, kAL,
+  // block 60
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM,
+  kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kEX, kBA, kBA, kBA, kAL, kEX, kBA,
+  // block 61
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kBA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM,
+  // block 62
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  // block 63
+  kQU, kQU, kQU, kQU, kQU, kQU, kQU, kQU, kQU, kQU, kQU, kQU, kQU, kQU, kBA, kBA,
+  kBA, kBA, kBA, kBA, kBA, kBA, kAL, kBA, kOP, kBA, kAL, kAL, kQU, kQU, kAL, kAL,
+  kQU, kQU, kOP, kCL, kOP, kCL, kOP, kCL, kOP, kCL, kBA, kBA, kBA, kBA, kEX, kAL,
+  kBA, kBA, kAL, kBA, kBA, kAL, kAL, kAL, kAL, kAL, kB2, kB2, kBA, kBA, kBA, kAL,
+  kBA, kBA, kOP, kBA, kBA, kBA, kBA, kBA, kBA, kBA, kBA, kAL, kBA, kAL, kBA, kBA,
+  kAL, kAL, kAL, kEX, kEX, kOP, kCL, kOP, kCL, kOP, kCL, kOP, kCL, kBA, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 64
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kAL, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 65
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  // block 66
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kAL, kAL, kAL, kAL,
+  // block 67
+  kBA, kCL, kCL, kID, kID, kNS, kID, kID, kOPEastAsian, kCL, kOPEastAsian, kCL, kOPEastAsian, kCL, kOPEastAsian, kCL,
+  kOPEastAsian, kCL, kID, kID, kOPEastAsian, kCL, kOPEastAsian, kCL, kOPEastAsian, kCL, kOPEastAsian, kCL, kNS, kOPEastAsian, kCL, kCL,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kCM, kCM, kCM, kCM, kCM, kCM,
+  kID, kID, kID, kID, kID, kCM, kID, kID, kID, kID, kID, kNS, kNS, kID, kID, kID,
+  kAL, kNS, kID, kNS, kID, kNS, kID, kNS, kID, kNS, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kNS, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  // block 68
+  kID, kID, kID, kNS, kID, kNS, kID, kNS, kID, kID, kID, kID, kID, kID, kNS, kID,
+  kID, kID, kID, kID, kID, kNS, kNS, kAL, kAL, kCM, kCM, kNS, kNS, kNS, kNS, kID,
+  kNS, kNS, kID, kNS, kID, kNS, kID, kNS, kID, kNS, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kNS, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kNS, kID, kNS, kID, kNS, kID, kID, kID, kID, kID, kID, kNS, kID,
+  kID, kID, kID, kID, kID, kNS, kNS, kID, kID, kID, kID, kNS, kNS, kNS, kNS, kID,
+  // block 69
+  kAL, kAL, kAL, kAL, kAL, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kAL, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  // block 70
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kAL,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNS, kNS, kNS, kNS, kNS, kNS, kNS, kNS, kNS, kNS, kNS, kNS, kNS, kNS, kNS, kNS,
+  // block 71
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kAL,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  // block 72
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 73
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kNS, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  // block 74
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kAL, kAL, kAL,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kBA, kBA,
+  // block 75
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kBA, kEX, kBA,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM,
+  kCM, kCM, kCM, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL,
+  // block 76
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kCM, kCM, kAL, kBA, kBA, kBA, kBA, kBA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 77
+  kAL, kAL, kCM, kAL, kAL, kAL, kCM, kAL, kAL, kAL, kAL, kCM, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kCM, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kPO, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kBB, kBB, kEX, kEX, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 78
+  kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kBA, kBA,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kBB, kAL, kAL, kCM,
+  // block 79
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kBA, kBA,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL,
+  kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kJL, kAL, kAL, kAL,
+  // block 80
+  kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kAL, kAL, kAL, kAL, kAL, kAL, kBA, kBA, kBA, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kSA, kSA, kSA, kSA, kSA, kAL,
+  // block 81
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kBA, kBA, kBA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  // block 82
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kSA, kSA, kSA, kSA, kSA,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM,
+  kBA, kBA, kAL, kAL, kAL, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 83
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kBA, kCM, kCM, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 84
+  kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  // block 85
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3,
+  // block 86
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  // block 87
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  // block 88
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  // block 89
+  kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  // block 90
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  // block 91
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH2, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3, kH3,
+  kH3, kH3, kH3, kH3, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV, kJV,
+  kJV, kJV, kJV, kJV, kJV, kJV, kJV, kAL, kAL, kAL, kAL, kJT, kJT, kJT, kJT, kJT,
+  kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT,
+  kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT,
+  kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kJT, kAL, kAL, kAL, kAL,
+  // block 92
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kHL, kCM, kHL,
+  kHL, kHL, kHL, kHL, kHL, kHL, kHL, kHL, kHL, kAL, kHL, kHL, kHL, kHL, kHL, kHL,
+  kHL, kHL, kHL, kHL, kHL, kHL, kHL, kAL, kHL, kHL, kHL, kHL, kHL, kAL, kHL, kAL,
+  kHL, kHL, kAL, kHL, kHL, kAL, kHL, kHL, kHL, kHL, kHL, kHL, kHL, kHL, kHL, kHL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 93
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCL, kOP,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 94
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kPO, kAL, kAL, kAL,
+  // block 95
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kIS, kCL, kCL, kIS, kIS, kEX, kEX, kOPEastAsian, kCL, kIN, kAL, kAL, kAL, kAL, kAL, kAL,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kID, kID, kID, kID, kID, kOPEastAsian, kCL, kOPEastAsian, kCL, kOPEastAsian, kCL, kOPEastAsian, kCL, kOPEastAsian, kCL, kOPEastAsian,
+  kCL, kOPEastAsian, kCL, kOPEastAsian, kCL, kID, kID, kOPEastAsian, kCL, kID, kID, kID, kID, kID, kID, kID,
+  kCL, kID, kCL, kAL, kNS, kNS, kEX, kEX, kID, kOPEastAsian, kCL, kOPEastAsian, kCL, kOPEastAsian, kCL, kID,
+  kID, kID, kID, kID, kID, kID, kID, kAL, kID, kPR, kPO, kID, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 96
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kWJ,
+  // block 97
+  kAL, kEX, kID, kID, kPR, kPO, kID, kID, kOPEastAsian, kCL, kID, kID, kCL, kID, kCL, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kNS, kNS, kID, kID, kID, kEX,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kOPEastAsian, kID, kCL, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kOPEastAsian, kID, kCL, kID, kOPEastAsian,
+  kCL, kCL, kOPEastAsian, kCL, kCL, kNS, kID, kNS, kNS, kNS, kNS, kNS, kNS, kNS, kNS, kNS,
+  kNS, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  // block 98
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kNS, kNS,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kAL,
+  kAL, kAL, kID, kID, kID, kID, kID, kID, kAL, kAL, kID, kID, kID, kID, kID, kID,
+  kAL, kAL, kID, kID, kID, kID, kID, kID, kAL, kAL, kID, kID, kID, kAL, kAL, kAL,
+  kPO, kPR, kID, kID, kID, kPR, kPR, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCB, kAL, kAL, kAL,
+  // block 99
+  kBA, kBA, kBA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 100
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kAL, kAL,
+  // block 101
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 102
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL,
+  // block 103
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kBA,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kBA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 104
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 105
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kBA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 106
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kBA,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 107
+  kAL, kCM, kCM, kCM, kAL, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kCM,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kBA, kBA, kBA, kBA, kBA, kBA, kBA, kBA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 108
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kBA, kBA, kBA, kBA, kBA, kBA, kIN, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 109
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kBA, kBA, kBA, kBA, kBA, kBA, kBA,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 110
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 111
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kBA, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM,
+  // block 112
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 113
+  kAL, kAL, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 114
+  kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kBA, kBA, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU,
+  kCM, kAL, kAL, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM,
+  // block 115
+  kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kBA, kBA,
+  kBA, kBA, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 116
+  kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kAL, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU,
+  kBA, kBA, kBA, kBA, kAL, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kCM, kAL, kBB, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 117
+  kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kAL, kAL, kAL, kAL, kBA, kBA, kAL, kBA, kCM, kCM, kCM, kCM, kAL, kCM, kCM,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kBB, kAL, kBA, kBA, kBA,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 118
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kBA, kBA, kAL, kBA, kBA, kAL, kCM, kAL,
+  kAL, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 119
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kBA, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 120
+  kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kAL, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kAL, kAL, kCM, kCM, kAL, kAL, kCM, kCM, kCM, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kCM, kCM, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL,
+  kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 121
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kBA, kBA, kBA, kBA, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kBA, kBA, kAL, kAL, kCM, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 122
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 123
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kBB, kBA, kBA, kEX, kEX, kAL, kAL, kAL, kBA, kBA, kBA, kBA, kBA, kBA, kBA,
+  kBA, kBA, kBA, kBA, kBA, kBA, kBA, kBA, kAL, kAL, kAL, kAL, kCM, kCM, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 124
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kBA, kBA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kBB, kBB, kBB, kBB, kBB, kBB, kBB, kBB, kBB, kBB, kBB, kBB, kBB, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 125
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 126
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kAL, kAL, kSA, kSA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kSA, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kSA, kSA, kBA, kBA, kBA, kSA,
+  kSA, kSA, kSA, kSA, kSA, kSA, kSA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 127
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 128
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 129
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kCM, kCM, kCM, kCM, kCM, kCM, kAL, kCM, kCM, kAL, kAL, kCM, kCM, kCM, kCM, kAL,
+  kCM, kAL, kCM, kCM, kBA, kBA, kBA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 130
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kAL, kBB, kAL, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 131
+  kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kCM, kCM, kCM, kCM, kBB,
+  kAL, kBA, kBA, kBA, kBA, kBB, kAL, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 132
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kBA, kBA, kBA, kAL, kBB, kBB,
+  kBB, kBA, kBA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 133
+  kBB, kBB, kBB, kBB, kBB, kBB, kBB, kBB, kBB, kBB, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 134
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kAL, kBA, kBA, kBA, kBA, kBA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kBB, kEX, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 135
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 136
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kCM, kAL, kCM, kCM, kAL, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kAL, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 137
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kAL,
+  kCM, kCM, kAL, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 138
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 139
+  kCM, kCM, kAL, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kCM, kCM,
+  kCM, kCM, kCM, kBA, kBA, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 140
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kPO, kPO, kPO,
+  kPO, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kBA,
+  // block 141
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kBA, kBA, kBA, kBA, kBA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 142
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kOP, kOP, kOP, kCL, kCL, kCL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 143
+  kAL, kAL, kCL, kAL, kAL, kAL, kOP, kCL, kOP, kCL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 144
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kOP, kCL, kCL, kAL, kAL, kAL, kAL,
+  // block 145
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kGL, kGL, kGL, kGL, kGL, kGL, kGL, kOP, kCL, kGL, kGL, kGL, kOP, kCL, kOP, kCL,
+  kCM, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 146
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kOP, kCL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 147
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kBA, kBA,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 148
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kCM, kCM, kCM, kCM, kCM, kBA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 149
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kBA, kBA, kBA, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kBA, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 150
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kBA, kBA, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 151
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM,
+  kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  // block 152
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM,
+  kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNS, kNS, kNS, kNS, kGL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 153
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 154
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 155
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kNS, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNS, kNS, kNS, kAL, kAL, kNS, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kNS, kNS, kNS, kNS, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  // block 156
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kAL, kAL, kAL, kAL,
+  // block 157
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kBA,
+  kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 158
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 159
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  // block 160
+  kCM, kCM, kCM, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 161
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 162
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kNU, kNU,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU,
+  // block 163
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 164
+  kAL, kAL, kAL, kAL, kCM, kAL, kAL, kBA, kBA, kBA, kBA, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM,
+  kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 165
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kAL, kCM, kCM, kAL, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 166
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 167
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 168
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kPR,
+  // block 169
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 170
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 171
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kOP, kOP,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 172
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kPO, kAL, kAL, kAL,
+  kPO, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 173
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  // block 174
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kIDUnassignedPictographic, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kIDUnassignedPictographic, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  // block 175
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kID, kID, kID,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kID, kID, kID,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 176
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kID, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kRI, kRI, kRI, kRI, kRI, kRI, kRI, kRI, kRI, kRI,
+  kRI, kRI, kRI, kRI, kRI, kRI, kRI, kRI, kRI, kRI, kRI, kRI, kRI, kRI, kRI, kRI,
+  // block 177
+  kID, kID, kID, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kID, kID, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kID, kID, kID, kID, kID, kID, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  // block 178
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  // block 179
+  kID, kID, kID, kID, kID, kEB, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kAL, kAL, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kAL, kAL, kID, kID, kID, kID, kID, kAL, kID, kID, kID,
+  kID, kID, kEB, kEB, kEB, kID, kID, kEB, kID, kID, kEB, kEB, kEB, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kEM, kEM, kEM, kEM, kEM,
+  // block 180
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kEB, kEB, kID, kID, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kEB,
+  kEB, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kEB,
+  kEB, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kID, kID, kID, kEB, kID, kID, kID,
+  // block 181
+  kID, kEB, kEB, kEB, kID, kEB, kEB, kEB, kID, kID, kID, kID, kID, kID, kID, kEB,
+  kID, kEB, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kAL, kID, kAL, kID, kAL, kID, kID, kID, kID, kID, kEB, kID, kID, kID, kID, kAL,
+  kID, kAL, kAL, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  // block 182
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kEB, kEB, kID, kID, kID, kID, kEB, kID, kID, kID, kID, kID,
+  // block 183
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kEB, kID, kID, kID, kID, kEB, kEB, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kAL, kAL, kAL, kAL, kAL, kAL, kID, kID, kID, kID, kID, kID,
+  // block 184
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kEB, kEB, kEB, kID, kID, kID, kEB, kEB, kEB, kEB, kEB,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kQU, kQU, kQU, kNS, kNS, kNS, kAL, kAL, kAL, kAL,
+  // block 185
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kEB, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kEB, kEB, kEB, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kEB, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kEB, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  // block 186
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kID, kID, kID, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kID, kID, kID, kID, kID,
+  // block 187
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kID, kID, kID, kID, kID, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kID, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  // block 188
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 189
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kID, kID, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  // block 190
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kEB, kID, kID, kEB,
+  kID, kID, kID, kID, kID, kID, kID, kID, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kEB,
+  kID, kID, kID, kID, kID, kID, kEB, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kEB, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kID, kID, kEB, kEB, kEB, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kEB, kID, kID, kID, kID, kID, kID, kID, kID,
+  // block 191
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kEB, kEB, kID, kEB, kEB, kID, kEB, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kEB, kEB, kEB,
+  kID, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  // block 192
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  // block 193
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kIDUnassignedPictographic, kID,
+  kID, kID, kID, kEB, kEB, kEB, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kEB, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kEB, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  // block 194
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kNU, kAL, kAL, kAL, kAL, kAL, kAL,
+  // block 195
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic,
+  kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kIDUnassignedPictographic, kAL, kAL,
+  // block 196
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID,
+  kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kID, kAL, kAL,
+  // block 197
+  kAL, kCM, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  // block 198
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  // block 199
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM, kCM,
+  kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL, kAL,
+};
+
+enum LineBreakAction : uint8_t {
+  kBreak,
+  kNoBreak,
+  kAttach,
+  kNoBreakInNumber,
+  kNoBreakIfNumberFollows,
+  kBreakIfNumberFollows,
+  kNoBreakAfterHebrewLetter,
+  kNoBreakAfterHebrewLetterOrBreak,
+  kNoBreakInRegionalIndicatorPair,
+};
+#define B kBreak
+#define N kNoBreak
+#define A kAttach
+#define U kNoBreakInNumber
+#define F kNoBreakIfNumberFollows
+#define S kBreakIfNumberFollows
+#define H kNoBreakAfterHebrewLetter
+#define W kNoBreakAfterHebrewLetterOrBreak
+#define R kNoBreakInRegionalIndicatorPair
+// What to do between the previous character and the next codepoint (the columns being its class).
+// The first kLineBreakClassesCount rows are for the class of the previous character,
+// the next ones for the class of the last character that was not a space when the previous character was a space.
+// CM and ZWJ are handled as AL when they are not attached to the previous character.
+static const LineBreakAction kLineBreakActions[2 * kLineBreakClassesCount][kLineBreakClassesCount] = {
+  { B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // BK
+  { B,B,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // CR
+  { B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // LF
+  { B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // NL
+  { N,N,N,N,N,N,A,A,N,B,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // SP
+  { N,N,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // ZW
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // ZWJ
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // CM
+  { N,N,N,N,N,N,A,A,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N },  // WJ
+  { N,N,N,N,N,N,A,A,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N },  // GL
+  { N,N,N,N,N,N,A,A,N,H,N,N,H,H,B,N,N,N,N,N,N,N,H,H,N,N,H,H,H,H,H,H,H,H,H,H,H,H,H,H,H,H },  // BA
+  { N,N,N,N,N,N,A,A,N,H,N,N,H,H,B,N,N,N,N,N,N,N,H,H,N,N,N,H,H,W,H,H,H,H,H,H,H,H,H,H,H,W },  // HY
+  { N,N,N,N,N,N,A,A,N,N,N,N,N,N,B,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N },  // BB
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,N,B,N,N,N,N,N,N,N,B,B,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // B2
+  { N,N,N,N,N,N,A,A,N,N,B,B,B,B,B,B,N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // CB
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // NS
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // EX
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,N,U,U,N,N,B,B,B,B,B,B,B,B,B,B,N },  // IS
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,U,U,U,B,N,B,B,B,B,B,B,B,B,B,B,B },  // SY
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,B,U,U,B,B,B,B,B,B,B,B,B,B,B,B,B },  // CL
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,N,U,U,N,N,B,B,B,B,B,B,B,B,B,B,N },  // CP
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,B,U,U,B,B,B,B,B,B,B,B,B,B,B,B,B },  // CPEastAsian
+  { N,N,N,N,N,N,A,A,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N },  // OP
+  { N,N,N,N,N,N,A,A,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N },  // OPEastAsian
+  { N,N,N,N,N,N,A,A,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N },  // QU
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // IN
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,N,B,N,N,N,U,U,N,N,B,B,B,B,B,B,B,B,B,B,N },  // NU
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,F,F,N,N,N,B,B,N,N,N,N,N,N,N,N,N,N,N,B,N },  // PR
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,F,F,N,N,N,B,B,N,N,B,B,B,B,B,B,B,B,B,B,N },  // PO
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,N,B,N,N,N,N,N,N,N,B,B,B,B,B,B,B,B,B,B,N },  // AL
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,N,B,N,N,N,N,N,N,N,B,B,B,B,B,B,B,B,B,B,N },  // HL
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,B,B,N,B,B,B,B,B,B,B,B,B,B,B,B,B },  // ID
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,B,B,N,B,B,B,B,B,N,B,B,B,B,B,B,B },  // IDUnassignedPictographic
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,B,B,N,B,B,B,B,B,N,B,B,B,B,B,B,B },  // EB
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,B,B,N,B,B,B,B,B,B,B,B,B,B,B,B,B },  // EM
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,B,B,N,B,B,B,B,B,B,N,N,B,N,N,B,B },  // JL
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,B,B,N,B,B,B,B,B,B,B,N,N,B,B,B,B },  // JV
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,B,B,N,B,B,B,B,B,B,B,B,N,B,B,B,B },  // JT
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,B,B,N,B,B,B,B,B,B,B,N,N,B,B,B,B },  // H2
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,B,B,N,B,B,B,B,B,B,B,B,N,B,B,B,B },  // H3
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,B,B,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,R,B },  // RI
+  { N,N,N,N,N,N,A,A,N,N,N,N,B,B,B,N,N,N,N,N,N,N,N,B,N,N,N,N,N,N,N,B,B,B,B,B,B,B,B,B,B,N },  // SA
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // BK SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // CR SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // LF SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // NL SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // SP SP+
+  { N,N,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // ZW SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // ZWJ SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // CM SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // WJ SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // GL SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // BA SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // HY SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // BB SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,N,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // B2 SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // CB SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // NS SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // EX SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // IS SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // SY SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,N,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // CL SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,N,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // CP SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,N,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // CPEastAsian SP+
+  { N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N },  // OP SP+
+  { N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N,N },  // OPEastAsian SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // QU SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // IN SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // NU SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // PR SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // PO SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // AL SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // HL SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // ID SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // IDUnassignedPictographic SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // EB SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // EM SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // JL SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // JV SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // JT SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // H2 SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // H3 SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // RI SP+
+  { N,N,N,N,N,N,B,B,N,B,B,B,B,B,B,B,N,S,N,N,N,N,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B,B },  // SA SP+
+};
+#undef B
+#undef N
+#undef A
+#undef U
+#undef F
+#undef S
+#undef H
+#undef W
+#undef R
@@ -0,0 +1,174 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "line_break.hh"
+#include "utf.hh"
+
+namespace glyphknit {
+
+#include "line_break-data.hh"
+
+static LineBreakClass GetLineBreakClass(UChar32 c) {
+  return kLineBreakClasses[(size_t(kLineBreakBlocks[c >> kLineBreakBlockShift]) << kLineBreakBlockShift) + size_t(c & (kLineBreakBlockSize-1))];
+}
+
+static void SetBit(uint64_t *bits, ssize_t index) {
+  bits[size_t(index) / 64] |= uint64_t(1) << (size_t(index) % 64);
+}
+
+static LineBreakClass NextClassIgnoringCombiningMarks(const uint16_t *text, ssize_t length, ssize_t &index) {
+  while (index < length) {
+    auto line_break_class = GetLineBreakClass(ConsumeCodepoint(text, length, index));
+    if (line_break_class != kCM && line_break_class != kZWJ) {
+      return line_break_class;
+    }
+  }
+  return kBK;  // end of the text
+}
+
+// if the text at index starts with "IS? NU", the combining marks being ignored (LB9)
+static bool IsNumberNext(const uint16_t *text, ssize_t length, ssize_t index) {
+  auto line_break_class = NextClassIgnoringCombiningMarks(text, length, index);
+  if (line_break_class == kIS) {
+    line_break_class = NextClassIgnoringCombiningMarks(text, length, index);
+  }
+  return line_break_class == kNU;
+}
+
+static LineBreakClass PreviousClassIgnoringCombiningMarks(const uint16_t *text, ssize_t &index) {
+  while (index > 0) {
+    U16_BACK_1(text, 0, index);
+    auto line_break_class = GetLineBreakClass(GetCodepoint(text, index + 2, index));
+    if (line_break_class != kCM && line_break_class != kZWJ) {
+      return line_break_class;
+    }
+  }
+  return kBK;  // start of the text
+}
+
+// if the text before index ends with "NU (NU | SY | IS)* (CL | CP)?" (for LB25), the combining marks being ignored (LB9)
+// (only called for the few pairs of classes concerned, so it is cheaper to look back than to keep track of numbers)
+static bool IsAfterNumber(const uint16_t *text, ssize_t index) {
+  auto line_break_class = PreviousClassIgnoringCombiningMarks(text, index);
+  if (line_break_class == kCL || line_break_class == kCP || line_break_class == kCPEastAsian) {
+    line_break_class = PreviousClassIgnoringCombiningMarks(text, index);
+  }
+  while (line_break_class == kSY || line_break_class == kIS) {
+    line_break_class = PreviousClassIgnoringCombiningMarks(text, index);
+  }
+  return line_break_class == kNU;
+}
+
+bool FindLineBreakOpportunities(const uint16_t *text, ssize_t length, uint64_t *bits) {
+  SetBit(bits, 0);
+  if (length == 0) {
+    return true;
+  }
+
+  // the class of the previous codepoint
+  ssize_t index = 0;
+  auto previous_class = GetLineBreakClass(ConsumeCodepoint(text, length, index));
+  if (previous_class == kSA) {
+    return false;
+  }
+  // the class of the previous character, once combining marks have been attached to their base (LB9) or handled as AL (LB10)
+  auto base_class = (previous_class == kCM || previous_class == kZWJ) ? kAL : previous_class;
+  // the class of the character before it (for LB21a)
+  auto class_before_base = kSP;
+  // the class of the last character that was not a space (SP if there were only spaces since the start)
+  auto class_before_spaces = base_class;
+  // the row of kLineBreakActions to use for the next codepoint
+  int actions_row = (base_class == kSP ? kLineBreakClassesCount + kSP : base_class);
+  bool is_break_before_base = true;
+  int regional_indicators_count = (base_class == kRI ? 1 : 0);  // in a row (for LB30a)
+
+  while (index < length) {
+    auto codepoint_start_index = index;
+    auto line_break_class = GetLineBreakClass(ConsumeCodepoint(text, length, index));
+    if (line_break_class == kSA) {
+      return false;
+    }
+
+    auto action = kLineBreakActions[actions_row][line_break_class];
+    if (action == kAttach) {
+      previous_class = line_break_class;
+      continue;
+    }
+    bool is_break;
+    if (previous_class == kZWJ) {
+      is_break = false;  // LB8a
+    }
+    else if (action <= kNoBreak) {
+      is_break = (action == kBreak);
+    }
+    else {
+      switch (action) {
+        case kNoBreakInNumber:
+          is_break = !IsAfterNumber(text, codepoint_start_index);
+          break;
+        case kNoBreakIfNumberFollows:
+          is_break = !IsNumberNext(text, length, index);
+          break;
+        case kBreakIfNumberFollows: {
+          auto next_index = index;
+          is_break = (NextClassIgnoringCombiningMarks(text, length, next_index) == kNU);
+          break;
+        }
+        case kNoBreakAfterHebrewLetter:
+          is_break = (class_before_base != kHL);
+          break;
+        case kNoBreakAfterHebrewLetterOrBreak:
+          is_break = (class_before_base != kHL && !is_break_before_base);
+          break;
+        case kNoBreakInRegionalIndicatorPair:
+          is_break = (regional_indicators_count % 2 == 0);
+          break;
+        default:
+          is_break = true;
+          break;
+      }
+    }
+    // without a branch as breaks are hard to predict
+    bits[size_t(codepoint_start_index) / 64] |= uint64_t(is_break) << (size_t(codepoint_start_index) % 64);
+
+    auto character_class = ((line_break_class == kCM || line_break_class == kZWJ) ? kAL : line_break_class);  // LB10
+    previous_class = line_break_class;
+    class_before_base = base_class;
+    base_class = character_class;
+    is_break_before_base = is_break;
+    if (character_class == kSP) {
+      actions_row = kLineBreakClassesCount + class_before_spaces;
+    }
+    else {
+      class_before_spaces = character_class;
+      actions_row = character_class;
+    }
+    regional_indicators_count = (character_class == kRI ? regional_indicators_count + 1 : 0);
+  }
+
+  SetBit(bits, length);  // LB3
+  return true;
+}
+
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "line_break_iterators.hh"
+
+#include <cassert>
+#include <cstring>
+#include <mutex>
+#include <unicode/uloc.h>
+#include <unicode/uvernum.h>
+
+namespace glyphknit {
+
+namespace {
+
+struct PrototypeIterator {
+  const UBreakIterator *iterator;
+  bool is_tailored;
+};
+
+}
+
+// the iterators opened for the whole process (never closed), that are only used to be cloned
+static std::mutex prototype_iterators_mutex;
+static std::unordered_map<Tag, PrototypeIterator> *prototype_iterators = nullptr;
+
+static PrototypeIterator GetPrototypeIterator(Tag language_code) {
+  std::lock_guard<std::mutex> lock{prototype_iterators_mutex};
+  if (prototype_iterators == nullptr) {
+    prototype_iterators = new std::unordered_map<Tag, PrototypeIterator>;
+  }
+  auto found = prototype_iterators->find(language_code);
+  if (found != prototype_iterators->end()) {
+    return found->second;
+  }
+
+  char locale[5] = "en";
+  if (language_code != kTagUnknown) {
+    for (int index = 0; index < 4; ++index) {
+      auto c = char((language_code >> (24 - 8 * index)) & 0xFF);
+      locale[index] = (c == kEmptyTagCharacter ? '\0' : c);
+    }
+  }
+  UErrorCode status = U_ZERO_ERROR;
+  auto iterator = ubrk_open(UBRK_LINE, locale, nullptr, 0, &status);
+  assert(U_SUCCESS(status));
+  // the rules of most languages are the root ones
+  auto actual_locale = ubrk_getLocaleByType(iterator, ULOC_ACTUAL_LOCALE, &status);
+  assert(U_SUCCESS(status));
+  PrototypeIterator prototype_iterator{
+    .iterator = iterator,
+    .is_tailored = (actual_locale != nullptr && actual_locale[0] != '\0' && std::strcmp(actual_locale, "root") != 0),
+  };
+  prototype_iterators->emplace(language_code, prototype_iterator);
+  return prototype_iterator;
+}
+
+LineBreakIterators::~LineBreakIterators() {
+  for (const auto &language_iterator : iterators_) {
+    if (language_iterator.second.iterator != nullptr) {
+      ubrk_close(language_iterator.second.iterator);
+    }
+  }
+}
+
+LineBreakIterators::LanguageIterator &LineBreakIterators::Find(Language language) {
+  auto found = iterators_.find(language.language_code);
+  if (found != iterators_.end()) {
+    return found->second;
+  }
+  auto prototype_iterator = GetPrototypeIterator(language.language_code);
+  return iterators_.emplace(language.language_code, LanguageIterator{.iterator = nullptr, .is_tailored = prototype_iterator.is_tailored}).first->second;
+}
+
+bool LineBreakIterators::IsTailored(Language language) {
+  return Find(language).is_tailored;
+}
+
+UBreakIterator *LineBreakIterators::Get(Language language) {
+  auto &language_iterator = Find(language);
+  if (language_iterator.iterator == nullptr) {
+    // cloning only copies the state of the iterator, the rules and dictionaries being shared
+    UErrorCode status = U_ZERO_ERROR;
+#if U_ICU_VERSION_MAJOR_NUM >= 69
+    language_iterator.iterator = ubrk_clone(GetPrototypeIterator(language.language_code).iterator, &status);
+#else
+    language_iterator.iterator = ubrk_safeClone(GetPrototypeIterator(language.language_code).iterator, nullptr, nullptr, &status);
+#endif
+    assert(U_SUCCESS(status));
+  }
+  return language_iterator.iterator;
+}
+
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "paragraph_boundaries.hh"
+#include "grapheme_cluster.hh"
+#include "line_break.hh"
+#include "utf.hh"
+
+#include <cassert>
+#include <unicode/uchar.h>
+
+namespace glyphknit {
+
+static bool IsWhitespaceCodepoint(UChar32 c) {
+  // same as u_isWhitespace, without calling it for ASCII
+  if (c < 0x80) {
+    return (c >= 0x09 && c <= 0x0D) || (c >= 0x1C && c <= 0x20);
+  }
+  return u_isWhitespace(c);
+}
+
+bool ParagraphBoundaries::Find(const uint16_t *text, ssize_t length) {
+  length_ = length;
+  // one more bit for the end of the text
+  auto words_count = size_t(length) / kWordBits + 1;
+  grapheme_cluster_boundaries_.assign(words_count, 0);
+  line_break_opportunities_.assign(words_count, 0);
+  whitespaces_.assign(words_count, 0);
+
+  FindGraphemeClusterBoundaries(text, length, grapheme_cluster_boundaries_.data());
+  bool found_line_break_opportunities = FindLineBreakOpportunities(text, length, line_break_opportunities_.data());
+  if (found_line_break_opportunities) {
+    for (size_t word_index = 0; word_index < words_count; ++word_index) {
+      line_break_opportunities_[word_index] &= grapheme_cluster_boundaries_[word_index];
+    }
+  }
+  else {
+    // text that needs a dictionary
+    line_break_opportunities_.assign(words_count, 0);
+    Set(line_break_opportunities_, length);
+  }
+
+  for (ssize_t index = 0; index < length; ) {
+    auto codepoint_start_index = index;
+    if (IsWhitespaceCodepoint(ConsumeCodepoint(text, length, index))) {
+      Set(whitespaces_, codepoint_start_index);
+    }
+  }
+  return found_line_break_opportunities;
+}
+
+void ParagraphBoundaries::FindLineBreakOpportunitiesWithIterator(const uint16_t *text, ssize_t start_index, ssize_t end_index, UBreakIterator *line_break_iterator) {
+  assert(start_index >= 0 && start_index <= end_index && end_index <= length_);
+  for (auto index = start_index; index < end_index; ++index) {
+    Clear(line_break_opportunities_, index);
+  }
+  // going forward with a line break iterator is much faster than asking about each index (ubrk_preceding and ubrk_isBoundary can take time proportional to the length of the text)
+  UErrorCode status = U_ZERO_ERROR;
+  ubrk_setText(line_break_iterator, text, int32_t(length_), &status);
+  assert(U_SUCCESS(status));
+  auto line_break = (start_index == 0 ? ubrk_first(line_break_iterator) : ubrk_following(line_break_iterator, int32_t(start_index - 1)));
+  for (; line_break != UBRK_DONE && line_break < end_index; line_break = ubrk_next(line_break_iterator)) {
+    if (IsGraphemeClusterBoundary(line_break)) {
+      Set(line_break_opportunities_, line_break);
+    }
+  }
+}
+
+ssize_t ParagraphBoundaries::NextGraphemeClusterBoundary(ssize_t index) const {
+  if (index >= length_) {
+    return length_;
+  }
+  auto bit_index = size_t(index) + 1;
+  auto word_index = bit_index / kWordBits;
+  auto word = grapheme_cluster_boundaries_[word_index] & (~Word(0) << (bit_index % kWordBits));
+  // there is always a boundary at the end of the text
+  while (word == 0) {
+    word = grapheme_cluster_boundaries_[++word_index];
+  }
+  return ssize_t(word_index * kWordBits) + __builtin_ctzll(word);
+}
+
+}
@@ -28,6 +28,7 @@
 #include <cstring>
 #include <algorithm>
 #include <functional>
+#include <iterator>
 
 namespace glyphknit {
 
@@ -0,0 +1,646 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "shaped_paragraph.hh"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+namespace glyphknit {
+
+size_t ShapedParagraph::FindCluster(size_t run_index, ssize_t text_index) const {
+  auto clusters_begin = clusters_.begin() + ssize_t(runs_[run_index].first_cluster_index);
+  auto clusters_end = clusters_.begin() + ssize_t(clusters_end_index(run_index));
+  auto found = std::lower_bound(clusters_begin, clusters_end, text_index, [](const Cluster &cluster, ssize_t index) {
+    return cluster.start_index < index;
+  });
+  return size_t(found - clusters_.begin());
+}
+
+void ShapedParagraph::MoveTo(ssize_t start_index) {
+  auto delta = start_index - start_index_;
+  if (delta == 0) {
+    return;
+  }
+  start_index_ += delta;
+  end_index_ += delta;
+  for (auto &run : runs_) {
+    run.start_index += delta;
+    run.end_index += delta;
+    for (auto &glyph : run.glyphs) {
+      glyph.cluster = uint32_t(glyph.cluster + delta);
+    }
+  }
+  for (auto &cluster : clusters_) {
+    cluster.start_index += delta;
+  }
+}
+
+ShapedParagraph::Lines ShapedParagraph::BreakLines(double available_width) const {
+  return BreakLines([available_width](size_t) { return available_width; });
+}
+
+ShapedParagraph::Lines ShapedParagraph::BreakLines(const LineWidthCallback &available_width_of_line, size_t first_line_index) const {
+  Lines lines;
+  BreakLinesFrom(lines, available_width_of_line, first_line_index, runs_.empty() ? start_index_ : runs_.front().start_index, 0, nullptr);
+  return lines;
+}
+
+bool ShapedParagraph::BreakLinesFrom(Lines &lines, const LineWidthCallback &available_width_of_line, size_t line_index, ssize_t line_start_index, size_t first_run_index, const LineStartCallback &stop_before_line) const {
+  Line line = {
+    .start_index = line_start_index,
+    .first_run_index = first_run_index,
+    .emergency_break = false,
+  };
+  double available_width = available_width_of_line(line_index);
+  double line_width = 0;
+  size_t run_index = first_run_index;
+  size_t cluster_index = (first_run_index < runs_.size() ? FindCluster(first_run_index, line_start_index) : clusters_.size());
+  size_t line_first_cluster_index = cluster_index;
+  size_t last_line_break_cluster_index = 0;  // not after line_first_cluster_index if there is no line break opportunity in the line
+
+  while (true) {
+    for (; run_index < runs_.size() && cluster_index == clusters_end_index(run_index); ++run_index) {
+      const auto &run = runs_[run_index];
+      if (run.end_of_line) {
+        line.end_index = run.end_index;
+        line.end_run_index = run_index + 1;
+        line.width = line_width;
+        line.emergency_break = false;
+        lines.push_back(line);
+
+        line.start_index = (run_index + 1 < runs_.size() ? runs_[run_index + 1].start_index : end_index_);
+        line.first_run_index = run_index + 1;
+        if (stop_before_line && stop_before_line(line.start_index, line.first_run_index)) {
+          return true;
+        }
+        available_width = available_width_of_line(++line_index);
+        line_width = 0;
+        line_first_cluster_index = cluster_index;
+      }
+    }
+    if (cluster_index == clusters_.size()) {
+      break;
+    }
+
+    const auto &cluster = clusters_[cluster_index];
+    if (cluster_index > line_first_cluster_index && cluster.has_flag(kLineBreakOpportunity)) {
+      last_line_break_cluster_index = cluster_index;
+    }
+    // the first cluster of a line always fits
+    if (cluster_index == line_first_cluster_index || cluster.has_flag(kHangingWhitespace) || line_width + cluster.advance <= available_width) {
+      line_width += cluster.advance;
+      ++cluster_index;
+      continue;
+    }
+
+    size_t break_cluster_index;
+    if (last_line_break_cluster_index > line_first_cluster_index) {
+      break_cluster_index = last_line_break_cluster_index;
+      line.emergency_break = false;
+    }
+    else {
+      break_cluster_index = cluster_index;
+      line.emergency_break = true;
+    }
+    const auto &break_cluster = clusters_[break_cluster_index];
+    double next_line_width = 0;
+    for (auto index = break_cluster_index; index < cluster_index; ++index) {
+      next_line_width += clusters_[index].advance;
+    }
+    line.end_index = break_cluster.start_index;
+    line.end_run_index = break_cluster.run_index + (break_cluster.start_index > runs_[break_cluster.run_index].start_index ? 1 : 0);
+    line.width = line_width - next_line_width;
+    lines.push_back(line);
+
+    // the clusters after the break are checked again as the next line might not have the same width
+    line.start_index = break_cluster.start_index;
+    line.first_run_index = break_cluster.run_index;
+    if (stop_before_line && stop_before_line(line.start_index, line.first_run_index)) {
+      return true;
+    }
+    available_width = available_width_of_line(++line_index);
+    line_width = 0;
+    line_first_cluster_index = break_cluster_index;
+    cluster_index = break_cluster_index;
+    run_index = break_cluster.run_index;
+  }
+
+  line.end_index = end_index_;
+  line.end_run_index = runs_.size();
+  line.width = line_width;
+  line.emergency_break = false;
+  lines.push_back(line);
+  return false;
+}
+
+namespace {
+
+// a place where a line can end
+struct BreakCandidate {
+  enum Kind {
+    kLineBreakOpportunity,
+    kEmergencyBreak,  // between the grapheme clusters of a word too wide for a line
+    kEndOfLine,  // a line separator follows the run
+    kEndOfParagraph,
+  };
+  Kind kind;
+  size_t cluster_index;  // the first cluster after the break
+  size_t run_index;  // for kEndOfLine, the run followed by the line separator
+  size_t word_first_cluster_index;  // for kEmergencyBreak, lines ending at it cannot start before the word
+  double fitting_end_position;  // position of the end of the line without the whitespace hanging at its end
+
+  bool is_forced() const { return kind == kEndOfLine || kind == kEndOfParagraph; }
+};
+
+// a break a line ending at one of the following break candidates can start from
+struct ActiveBreak {
+  size_t candidate_index;  // in the break candidates, one past it (0 for the start of the paragraph)
+  int fitness_class;
+  double total_demerits;  // of all the lines before the break
+  size_t previous_break_index;  // in the breaks found
+};
+
+enum FitnessClass {
+  kVeryLoose,
+  kLoose,
+  kDecent,
+  kFitnessClassesCount,
+};
+
+}
+
+static const double kMaxBadness = 10000;
+
+static double Badness(double unused_width, double stretch) {
+  if (unused_width <= 0) {
+    return 0;
+  }
+  if (stretch <= 0) {
+    return kMaxBadness;
+  }
+  double ratio = unused_width / stretch;
+  return std::min(100 * ratio * ratio * ratio, kMaxBadness);
+}
+
+static FitnessClass FitnessClassForBadness(double badness) {
+  if (badness > 99) {
+    return kVeryLoose;
+  }
+  if (badness > 12) {
+    return kLoose;
+  }
+  return kDecent;
+}
+
+ShapedParagraph::Lines ShapedParagraph::BreakLinesOptimally(double available_width, const OptimalLineBreakingParameters &parameters) const {
+  assert(parameters.max_active_breaks > 0);
+  if (clusters_.empty()) {
+    return BreakLines(available_width);
+  }
+
+  // position of the start of each cluster, and of the end of the last one
+  std::vector<double> positions(clusters_.size() + 1);
+  positions[0] = 0;
+  for (size_t cluster_index = 0; cluster_index < clusters_.size(); ++cluster_index) {
+    positions[cluster_index + 1] = positions[cluster_index] + clusters_[cluster_index].advance;
+  }
+
+  // the break candidates in logical order, the clusters of words too wide for a line being added as emergency breaks
+  std::vector<BreakCandidate> candidates;
+  size_t word_first_cluster_index = 0;
+  size_t trailing_whitespace_start_index = 0;  // of the whitespace just before the cluster being looked at
+  auto AddCandidate = [&](BreakCandidate::Kind kind, size_t cluster_index, size_t run_index) {
+    if (!candidates.empty() && candidates.back().kind == BreakCandidate::kEndOfLine && candidates.back().cluster_index == cluster_index && kind == BreakCandidate::kLineBreakOpportunity) {
+      return;
+    }
+    // the whitespace hanging at the end of a line can start before the previous candidate (like spaces before a tab),
+    // the width of the lines starting after it being bounded by 0 when breaking
+    double fitting_end_position = positions[trailing_whitespace_start_index];
+    if (fitting_end_position - positions[word_first_cluster_index] > available_width) {
+      size_t emergency_trailing_whitespace_start_index = word_first_cluster_index;
+      for (auto index = word_first_cluster_index + 1; index < cluster_index; ++index) {
+        if (!clusters_[index - 1].has_flag(kHangingWhitespace)) {
+          emergency_trailing_whitespace_start_index = index;
+        }
+        candidates.push_back(BreakCandidate{
+          .kind = BreakCandidate::kEmergencyBreak,
+          .cluster_index = index,
+          .run_index = 0,
+          .word_first_cluster_index = word_first_cluster_index,
+          .fitting_end_position = positions[emergency_trailing_whitespace_start_index],
+        });
+      }
+    }
+    candidates.push_back(BreakCandidate{
+      .kind = kind,
+      .cluster_index = cluster_index,
+      .run_index = run_index,
+      .word_first_cluster_index = cluster_index,
+      .fitting_end_position = fitting_end_position,
+    });
+    word_first_cluster_index = cluster_index;
+  };
+  for (size_t run_index = 0; run_index < runs_.size(); ++run_index) {
+    for (auto cluster_index = runs_[run_index].first_cluster_index; cluster_index < clusters_end_index(run_index); ++cluster_index) {
+      const auto &cluster = clusters_[cluster_index];
+      if (cluster_index > 0 && cluster.has_flag(kLineBreakOpportunity)) {
+        AddCandidate(BreakCandidate::kLineBreakOpportunity, cluster_index, cluster.run_index);
+      }
+      if (!cluster.has_flag(kHangingWhitespace)) {
+        trailing_whitespace_start_index = cluster_index + 1;
+      }
+    }
+    if (runs_[run_index].end_of_line) {
+      AddCandidate(BreakCandidate::kEndOfLine, clusters_end_index(run_index), run_index);
+    }
+  }
+  AddCandidate(BreakCandidate::kEndOfParagraph, clusters_.size(), runs_.size());
+
+  // a first pass only with lines within the tolerance, and if the paragraph cannot be broken that way a second one accepting any line
+  std::vector<ActiveBreak> breaks;
+  std::vector<size_t> active_breaks;  // indexes in breaks, in logical order
+  std::vector<size_t> still_active_breaks;
+  size_t last_break_index = 0;
+  for (double tolerance : {parameters.tolerance, std::numeric_limits<double>::infinity()}) {
+    breaks.clear();
+    breaks.push_back(ActiveBreak{
+      .candidate_index = 0,
+      .fitness_class = kDecent,
+      .total_demerits = 0,
+      .previous_break_index = 0,
+    });
+    active_breaks.assign(1, 0);
+
+    for (size_t candidate_index = 0; candidate_index < candidates.size() && !active_breaks.empty(); ++candidate_index) {
+      const auto &candidate = candidates[candidate_index];
+      bool last_line = candidate.is_forced();
+      ActiveBreak best_breaks[kFitnessClassesCount];
+      bool found_breaks[kFitnessClassesCount] = {};
+
+      still_active_breaks.clear();
+      for (auto break_index : active_breaks) {
+        const auto &active_break = breaks[break_index];
+        size_t line_first_cluster_index = (active_break.candidate_index == 0 ? 0 : candidates[active_break.candidate_index - 1].cluster_index);
+        if (candidate.kind == BreakCandidate::kEmergencyBreak && line_first_cluster_index < candidate.word_first_cluster_index) {
+          still_active_breaks.push_back(break_index);
+          continue;
+        }
+        double line_width = std::max(candidate.fitting_end_position - positions[line_first_cluster_index], 0.0);
+        bool overfull = (line_width > available_width);
+        // the lines after the break will only be longer, but a line must at least go to the next break candidate
+        if (overfull && active_break.candidate_index != candidate_index) {
+          continue;
+        }
+        if (!overfull && !last_line) {
+          still_active_breaks.push_back(break_index);
+        }
+
+        double badness = (overfull ? kMaxBadness : last_line ? 0 : Badness(available_width - line_width, parameters.stretch * available_width));
+        if (!overfull && badness > tolerance) {
+          continue;
+        }
+        double demerits = (parameters.line_penalty + badness) * (parameters.line_penalty + badness);
+        if (candidate.kind == BreakCandidate::kEmergencyBreak) {
+          demerits += parameters.emergency_break_penalty * parameters.emergency_break_penalty;
+        }
+        auto fitness_class = (last_line ? kDecent : FitnessClassForBadness(badness));
+        if (!last_line && std::abs(fitness_class - active_break.fitness_class) > 1) {
+          demerits += parameters.adjacent_fitness_demerits;
+        }
+        demerits += active_break.total_demerits;
+        if (!found_breaks[fitness_class] || demerits < best_breaks[fitness_class].total_demerits) {
+          found_breaks[fitness_class] = true;
+          best_breaks[fitness_class] = ActiveBreak{
+            .candidate_index = candidate_index + 1,
+            .fitness_class = fitness_class,
+            .total_demerits = demerits,
+            .previous_break_index = break_index,
+          };
+        }
+      }
+      if (candidate.is_forced()) {
+        still_active_breaks.clear();
+      }
+
+      auto first_new_break_position = still_active_breaks.size();
+      for (int fitness_class = 0; fitness_class < kFitnessClassesCount; ++fitness_class) {
+        if (found_breaks[fitness_class]) {
+          still_active_breaks.push_back(breaks.size());
+          breaks.push_back(best_breaks[fitness_class]);
+        }
+      }
+      // bounding the number of active breaks, but never dropping the ones just found so the paragraph can always be broken
+      while (still_active_breaks.size() > std::max(parameters.max_active_breaks, still_active_breaks.size() - first_new_break_position)) {
+        auto worst = std::max_element(still_active_breaks.begin(), still_active_breaks.begin() + ssize_t(first_new_break_position), [&](size_t break_index_a, size_t break_index_b) {
+          return breaks[break_index_a].total_demerits < breaks[break_index_b].total_demerits;
+        });
+        still_active_breaks.erase(worst);
+        --first_new_break_position;
+      }
+      std::swap(active_breaks, still_active_breaks);
+    }
+
+    // the best way to end the paragraph
+    last_break_index = 0;
+    for (auto break_index : active_breaks) {
+      if (breaks[break_index].candidate_index == candidates.size() && (last_break_index == 0 || breaks[break_index].total_demerits < breaks[last_break_index].total_demerits)) {
+        last_break_index = break_index;
+      }
+    }
+    if (last_break_index != 0) {
+      break;
+    }
+  }
+  assert(last_break_index != 0);
+
+  std::vector<size_t> line_end_candidate_indexes;
+  for (auto break_index = last_break_index; break_index != 0; break_index = breaks[break_index].previous_break_index) {
+    line_end_candidate_indexes.push_back(breaks[break_index].candidate_index - 1);
+  }
+  std::reverse(line_end_candidate_indexes.begin(), line_end_candidate_indexes.end());
+
+  Lines lines;
+  Line line = {
+    .start_index = runs_.front().start_index,
+    .first_run_index = 0,
+  };
+  size_t line_first_cluster_index = 0;
+  for (auto candidate_index : line_end_candidate_indexes) {
+    const auto &candidate = candidates[candidate_index];
+    line.width = positions[candidate.cluster_index] - positions[line_first_cluster_index];
+    line.emergency_break = (candidate.kind == BreakCandidate::kEmergencyBreak);
+    switch (candidate.kind) {
+    case BreakCandidate::kLineBreakOpportunity:
+    case BreakCandidate::kEmergencyBreak: {
+      const auto &cluster = clusters_[candidate.cluster_index];
+      line.end_index = cluster.start_index;
+      line.end_run_index = cluster.run_index + (cluster.start_index > runs_[cluster.run_index].start_index ? 1 : 0);
+      lines.push_back(line);
+      line.start_index = cluster.start_index;
+      line.first_run_index = cluster.run_index;
+      break;
+    }
+    case BreakCandidate::kEndOfLine:
+      line.end_index = runs_[candidate.run_index].end_index;
+      line.end_run_index = candidate.run_index + 1;
+      lines.push_back(line);
+      line.start_index = (candidate.run_index + 1 < runs_.size() ? runs_[candidate.run_index + 1].start_index : end_index_);
+      line.first_run_index = candidate.run_index + 1;
+      break;
+    case BreakCandidate::kEndOfParagraph:
+      line.end_index = end_index_;
+      line.end_run_index = runs_.size();
+      lines.push_back(line);
+      break;
+    }
+    line_first_cluster_index = candidate.cluster_index;
+  }
+  return lines;
+}
+
+ShapedParagraph::IntrinsicWidths ShapedParagraph::FindIntrinsicWidths() const {
+  IntrinsicWidths widths = {
+    .min_content = 0,
+    .max_content = 0,
+  };
+  // the widths are added in the same order as in BreakLinesFrom so that the lines fit exactly at these widths
+  double line_width = 0;
+  double line_fitting_width = 0;  // without the whitespace at the end
+  double word_width = 0;
+  double word_fitting_width = 0;
+  for (size_t run_index = 0; run_index < runs_.size(); ++run_index) {
+    for (auto cluster_index = runs_[run_index].first_cluster_index; cluster_index < clusters_end_index(run_index); ++cluster_index) {
+      const auto &cluster = clusters_[cluster_index];
+      if (cluster.has_flag(kLineBreakOpportunity)) {
+        widths.min_content = std::max(widths.min_content, word_fitting_width);
+        word_width = 0;
+        word_fitting_width = 0;
+      }
+      line_width += cluster.advance;
+      word_width += cluster.advance;
+      if (!cluster.has_flag(kHangingWhitespace)) {
+        line_fitting_width = line_width;
+        word_fitting_width = word_width;
+      }
+    }
+    if (runs_[run_index].end_of_line) {
+      widths.min_content = std::max(widths.min_content, word_fitting_width);
+      widths.max_content = std::max(widths.max_content, line_fitting_width);
+      line_width = line_fitting_width = word_width = word_fitting_width = 0;
+    }
+  }
+  widths.min_content = std::max(widths.min_content, word_fitting_width);
+  widths.max_content = std::max(widths.max_content, line_fitting_width);
+  return widths;
+}
+
+// the difference from the smallest width that does not add lines the balanced width can have, in pixels
+static const double kBalancedWidthPrecision = 1.0 / 64;
+
+ShapedParagraph::Lines ShapedParagraph::BreakLinesBalanced(double available_width) const {
+  auto lines = BreakLines(available_width);
+  if (lines.size() < 2) {
+    return lines;
+  }
+
+  // lines narrower than that cannot hold all the clusters (only the whitespace at the end of lines is ignored)
+  double content_width = 0;
+  for (const auto &cluster : clusters_) {
+    if (!cluster.has_flag(kHangingWhitespace)) {
+      content_width += cluster.advance;
+    }
+  }
+  double too_narrow_width = content_width / double(lines.size()) - kBalancedWidthPrecision;
+  double wide_enough_width = available_width;
+  auto balanced_lines = lines;
+  while (wide_enough_width - too_narrow_width > kBalancedWidthPrecision) {
+    double width = (too_narrow_width + wide_enough_width) / 2;
+    auto trial_lines = BreakLines(width);
+    if (trial_lines.size() > lines.size()) {
+      too_narrow_width = width;
+    }
+    else {
+      wide_enough_width = width;
+      balanced_lines = std::move(trial_lines);
+    }
+  }
+  return balanced_lines;
+}
+
+static bool HaveSameAttributes(const ShapedParagraph::Run &run_a, const ShapedParagraph::Run &run_b) {
+  return run_a.font_descriptor == run_b.font_descriptor && IsFontSizeSimilar(run_a.font_size, run_b.font_size) && run_a.opentype_language_tag == run_b.opentype_language_tag
+      && run_a.script == run_b.script && run_a.bidi_direction == run_b.bidi_direction && run_a.end_of_line == run_b.end_of_line;
+}
+
+// if the cluster of the paragraph is the same as the one of the other paragraph, moved by index_delta (the glyphs must also be the same)
+static bool IsSameCluster(const ShapedParagraph &paragraph, const ShapedParagraph::Cluster &cluster, const ShapedParagraph &other_paragraph, const ShapedParagraph::Cluster &other_cluster, ssize_t index_delta, ssize_t run_index_delta) {
+  if (cluster.start_index != other_cluster.start_index + index_delta || cluster.run_index != other_cluster.run_index + run_index_delta
+      || cluster.flags != other_cluster.flags || std::islessgreater(cluster.advance, other_cluster.advance) || cluster.glyphs_count != other_cluster.glyphs_count) {
+    return false;
+  }
+  const auto *glyphs = paragraph.runs()[cluster.run_index].glyphs.data() + cluster.glyph_index;
+  const auto *other_glyphs = other_paragraph.runs()[other_cluster.run_index].glyphs.data() + other_cluster.glyph_index;
+  for (size_t glyph_index = 0; glyph_index < cluster.glyphs_count; ++glyph_index) {
+    const auto &glyph = glyphs[glyph_index];
+    const auto &other_glyph = other_glyphs[glyph_index];
+    if (glyph.id != other_glyph.id || glyph.cluster != other_glyph.cluster + index_delta || glyph.x_advance != other_glyph.x_advance
+        || glyph.y_advance != other_glyph.y_advance || glyph.x_offset != other_glyph.x_offset || glyph.y_offset != other_glyph.y_offset) {
+      return false;
+    }
+  }
+  return true;
+}
+
+ShapedParagraph::Lines ShapedParagraph::BreakLinesAgain(double available_width, const ShapedParagraph &previous, const Lines &previous_lines, Reflow *reflow, const LineConfirmationCallback &confirm_line) const {
+  assert(previous.start_index_ == start_index_ && !previous_lines.empty());
+  auto available_width_of_line = [available_width](size_t) { return available_width; };
+
+  // first difference from the start (runs are compared separately as some do not have any clusters)
+  size_t same_runs_count = 0;
+  while (same_runs_count < std::min(runs_.size(), previous.runs_.size())) {
+    const auto &run = runs_[same_runs_count];
+    const auto &previous_run = previous.runs_[same_runs_count];
+    if (run.start_index != previous_run.start_index || run.bidi_visual_index != previous_run.bidi_visual_index || !HaveSameAttributes(run, previous_run)) {
+      break;
+    }
+    ++same_runs_count;
+  }
+  ssize_t first_difference_index = std::min(end_index_, previous.end_index_);
+  if (same_runs_count < runs_.size()) {
+    first_difference_index = std::min(first_difference_index, runs_[same_runs_count].start_index);
+  }
+  if (same_runs_count < previous.runs_.size()) {
+    first_difference_index = std::min(first_difference_index, previous.runs_[same_runs_count].start_index);
+  }
+  size_t same_clusters_count = 0;
+  while (same_clusters_count < std::min(clusters_.size(), previous.clusters_.size())
+         && clusters_[same_clusters_count].start_index < first_difference_index
+         && IsSameCluster(*this, clusters_[same_clusters_count], previous, previous.clusters_[same_clusters_count], 0, 0)) {
+    ++same_clusters_count;
+  }
+  if (same_clusters_count < clusters_.size()) {
+    first_difference_index = std::min(first_difference_index, clusters_[same_clusters_count].start_index);
+  }
+  if (same_clusters_count < previous.clusters_.size()) {
+    first_difference_index = std::min(first_difference_index, previous.clusters_[same_clusters_count].start_index);
+  }
+  if (end_index_ == previous.end_index_ && runs_.size() == previous.runs_.size() && same_runs_count == runs_.size() && same_clusters_count == clusters_.size() && same_clusters_count == previous.clusters_.size()) {
+    *reflow = Reflow{previous_lines.size(), previous_lines.size(), previous_lines.size(), 0, 0, 0};
+    return previous_lines;
+  }
+
+  // start of the part that is the same at the end
+  auto index_delta = end_index_ - previous.end_index_;
+  auto run_index_delta = ssize_t(runs_.size()) - ssize_t(previous.runs_.size());
+  int32_t bidi_visual_index_delta = (runs_.empty() || previous.runs_.empty() ? 0 : runs_.back().bidi_visual_index - previous.runs_.back().bidi_visual_index);
+  size_t run_index = runs_.size();
+  size_t previous_run_index = previous.runs_.size();
+  size_t cluster_index = clusters_.size();
+  size_t previous_cluster_index = previous.clusters_.size();
+  ssize_t same_end_start_index = end_index_;  // the start of the first of the runs [run_index, end) found to be the same
+  for (; run_index > 0 && previous_run_index > 0; --run_index, --previous_run_index) {
+    const auto &run = runs_[run_index - 1];
+    const auto &previous_run = previous.runs_[previous_run_index - 1];
+    if (run.end_index != previous_run.end_index + index_delta || run.bidi_visual_index != previous_run.bidi_visual_index + bidi_visual_index_delta || !HaveSameAttributes(run, previous_run)) {
+      break;
+    }
+    while (cluster_index > run.first_cluster_index && previous_cluster_index > previous_run.first_cluster_index
+           && IsSameCluster(*this, clusters_[cluster_index - 1], previous, previous.clusters_[previous_cluster_index - 1], index_delta, run_index_delta)) {
+      --cluster_index;
+      --previous_cluster_index;
+    }
+    if (cluster_index > run.first_cluster_index || previous_cluster_index > previous_run.first_cluster_index || run.start_index != previous_run.start_index + index_delta) {
+      // only the end of the run is the same
+      if (cluster_index < clusters_end_index(run_index - 1)) {
+        same_end_start_index = clusters_[cluster_index].start_index;
+      }
+      break;
+    }
+    same_end_start_index = run.start_index;
+  }
+
+  // the previous line has to be broken again as the change might make what starts the line fit on it
+  auto first_different_line = std::upper_bound(previous_lines.begin(), previous_lines.end(), std::max(first_difference_index - 1, start_index_), [](ssize_t index, const Line &line) {
+    return index < line.start_index;
+  });
+  size_t first_line_index = size_t(first_different_line - previous_lines.begin());
+  first_line_index = (first_line_index < 2 ? 0 : first_line_index - 2);
+
+  Lines lines(previous_lines.begin(), previous_lines.begin() + ssize_t(first_line_index));
+  size_t previous_end_line_index = previous_lines.size();
+  auto stop_before_line = [&](ssize_t line_start_index, size_t line_first_run_index) {
+    if (line_start_index < same_end_start_index) {
+      return false;
+    }
+    auto previous_line = std::lower_bound(previous_lines.begin() + ssize_t(first_line_index), previous_lines.end(), line_start_index - index_delta, [](const Line &line, ssize_t index) {
+      return line.start_index < index;
+    });
+    for (; previous_line != previous_lines.end() && previous_line->start_index == line_start_index - index_delta; ++previous_line) {
+      if (ssize_t(previous_line->first_run_index) + run_index_delta == ssize_t(line_first_run_index)) {
+        previous_end_line_index = size_t(previous_line - previous_lines.begin());
+        return true;
+      }
+    }
+    return false;
+  };
+  bool stopped = BreakLinesFrom(lines, available_width_of_line, first_line_index, previous_lines[first_line_index].start_index, previous_lines[first_line_index].first_run_index, stop_before_line);
+  if (confirm_line) {
+    // the lines are only the same as the previous ones from where they stopped if the line before is confirmed
+    for (auto line_index = first_line_index; line_index < lines.size(); ++line_index) {
+      size_t next_line_first_run_index;
+      if (confirm_line(lines[line_index], &next_line_first_run_index)) {
+        auto next_line_start_index = lines[line_index].end_index;
+        lines.resize(line_index + 1);
+        previous_end_line_index = previous_lines.size();
+        stopped = (stop_before_line(next_line_start_index, next_line_first_run_index)
+                   || BreakLinesFrom(lines, available_width_of_line, line_index + 1, next_line_start_index, next_line_first_run_index, stop_before_line));
+      }
+    }
+  }
+  *reflow = Reflow{
+    .first_line_index = first_line_index,
+    .end_line_index = lines.size(),
+    .previous_end_line_index = previous_end_line_index,
+    .index_delta = index_delta,
+    .run_index_delta = run_index_delta,
+    .bidi_visual_index_delta = bidi_visual_index_delta,
+  };
+  if (stopped) {
+    for (auto previous_line = previous_lines.begin() + ssize_t(previous_end_line_index); previous_line != previous_lines.end(); ++previous_line) {
+      lines.push_back(*previous_line);
+      auto &line = lines.back();
+      line.start_index += index_delta;
+      line.end_index += index_delta;
+      line.first_run_index = size_t(ssize_t(line.first_run_index) + run_index_delta);
+      line.end_run_index = size_t(ssize_t(line.end_run_index) + run_index_delta);
+    }
+  }
+  return lines;
+}
+
+}
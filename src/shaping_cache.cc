@@ -0,0 +1,114 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "shaping_cache.hh"
+
+#include <cassert>
+
+namespace glyphknit {
+
+const size_t ShapingCache::kMaxSegmentLength;
+const size_t ShapingCache::kDefaultMemoryBudget;
+
+// rough estimate of the memory used by the nodes of the list and map besides the entry itself
+static const size_t kEntryOverhead = 8 * sizeof(void *);
+
+size_t ShapingCache::KeyHash::operator()(const Key *key) const {
+  // FNV-1a
+  size_t hash = 2166136261u;
+  auto combine = [&hash](size_t value) {
+    hash = (hash ^ value) * 16777619u;
+  };
+  combine(reinterpret_cast<uintptr_t>(key->hb_font));
+  combine(hb_segment_properties_hash(&key->segment_properties));
+  for (auto c : key->text) {
+    combine(c);
+  }
+  return hash;
+}
+
+bool ShapingCache::KeyEqual::operator()(const Key *a, const Key *b) const {
+  return a->hb_font == b->hb_font
+    && hb_segment_properties_equal(&a->segment_properties, &b->segment_properties)
+    && a->text == b->text;
+}
+
+ShapingCache::ShapingCache(size_t memory_budget) : memory_budget_{memory_budget}, memory_used_{0}, hits_count_{0}, misses_count_{0} {
+}
+
+void ShapingCache::SetLookupKey(FontDescriptor font_descriptor, const hb_segment_properties_t &segment_properties, const uint16_t *text, size_t length) {
+  lookup_key_.hb_font = font_descriptor.GetHBFont();
+  lookup_key_.segment_properties = segment_properties;
+  lookup_key_.text.assign(text, text + length);
+}
+
+const ShapingCache::Glyphs *ShapingCache::Find(FontDescriptor font_descriptor, const hb_segment_properties_t &segment_properties, const uint16_t *text, size_t length) {
+  SetLookupKey(font_descriptor, segment_properties, text, length);
+  auto found = entries_by_key_.find(&lookup_key_);
+  if (found == entries_by_key_.end()) {
+    ++misses_count_;
+    return nullptr;
+  }
+  ++hits_count_;
+  auto entry = found->second;
+  entries_.splice(entries_.begin(), entries_, entry);
+  return &entry->glyphs;
+}
+
+void ShapingCache::Add(FontDescriptor font_descriptor, const hb_segment_properties_t &segment_properties, const uint16_t *text, size_t length, Glyphs &&glyphs) {
+  assert(length <= kMaxSegmentLength);
+  SetLookupKey(font_descriptor, segment_properties, text, length);
+  if (entries_by_key_.find(&lookup_key_) != entries_by_key_.end()) {
+    return;
+  }
+
+  entries_.emplace_front(Entry{lookup_key_, font_descriptor, std::move(glyphs), 0});
+  auto &entry = entries_.front();
+  entry.memory_used = sizeof(Entry) + kEntryOverhead + entry.key.text.capacity() * sizeof(uint16_t) + entry.glyphs.capacity() * sizeof(Glyph);
+  memory_used_ += entry.memory_used;
+  entries_by_key_.emplace(&entry.key, entries_.begin());
+  EvictUntilUnderBudget();
+}
+
+void ShapingCache::EvictUntilUnderBudget() {
+  while (memory_used_ > memory_budget_ && !entries_.empty()) {
+    auto &entry = entries_.back();
+    entries_by_key_.erase(&entry.key);
+    memory_used_ -= entry.memory_used;
+    entries_.pop_back();
+  }
+}
+
+void ShapingCache::set_memory_budget(size_t memory_budget) {
+  memory_budget_ = memory_budget;
+  EvictUntilUnderBudget();
+}
+
+void ShapingCache::Clear() {
+  entries_by_key_.clear();
+  entries_.clear();
+  memory_used_ = 0;
+}
+
+}
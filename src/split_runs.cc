@@ -26,7 +26,10 @@
 #include "script_iterator.hh"
 #include "utf.hh"
 #include "newline.hh"
-#include "at_scope_exit.hh"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
 
 namespace glyphknit {
 
@@ -41,7 +44,7 @@ class RunSplitter {
     return *previous_run;
   }
 
-  RunSplitter(ListOfRuns &runs) : runs_(runs), current_run_{runs.begin()} {
+  RunSplitter(ListOfRuns &runs, ListOfRuns *spare_runs) : runs_(runs), spare_runs_(spare_runs), current_run_{runs.begin()} {
   }
 
   template <typename Callback>
@@ -56,7 +59,15 @@ class RunSplitter {
       ++current_run_;
     }
     else {
-      auto new_run = runs_.insert(current_run_, *current_run_);
+      ListOfRuns::iterator new_run;
+      if (spare_runs_ != nullptr && !spare_runs_->empty()) {
+        runs_.splice(current_run_, *spare_runs_, spare_runs_->begin());
+        new_run = std::prev(current_run_);
+        *new_run = *current_run_;
+      }
+      else {
+        new_run = runs_.insert(current_run_, *current_run_);
+      }
       new_run->end_index = index;
       callback(*new_run);
       current_run_->start_index = index;
@@ -76,7 +87,13 @@ class RunSplitter {
       ++current_run_;
     }
     if (current_run_->end_index == index) {
-      runs_.erase(current_run_++);
+      auto thrown_away_run = current_run_++;
+      if (spare_runs_ != nullptr) {
+        spare_runs_->splice(spare_runs_->end(), runs_, thrown_away_run);
+      }
+      else {
+        runs_.erase(thrown_away_run);
+      }
     }
     else {
       current_run_->start_index = index;
@@ -85,6 +102,7 @@ class RunSplitter {
 
  private:
   ListOfRuns &runs_;
+  ListOfRuns *spare_runs_;
   ListOfRuns::iterator current_run_;
 };
 
@@ -98,13 +116,19 @@ auto FirstRunAfter(const TextBlock &text_block, ssize_t index) {
 
 }
 
-void SplitRunsByLanguage(ListOfRuns &runs, const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index) {
+SplitRunsStorage::~SplitRunsStorage() {
+  if (bidi != nullptr) {
+    ubidi_close(bidi);
+  }
+}
+
+void SplitRunsByLanguage(ListOfRuns &runs, const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index, ListOfRuns *spare_runs) {
   ScriptIterator script_iterator{text_block.text_content(), paragraph_start_index, paragraph_end_index};
   auto current_attributes_run = FirstRunAfter(text_block, paragraph_start_index);
   auto attributes_run_end = text_block.attributes_runs().end();
 
   auto run_start = paragraph_start_index;
-  RunSplitter splitter{runs};
+  RunSplitter splitter{runs, spare_runs};
 
   auto script_run = script_iterator.FindNextRun();
   auto default_language = GuessLanguageFromScript(script_run.script);
@@ -156,8 +180,8 @@ void SplitRunsByLanguage(ListOfRuns &runs, const TextBlock &text_block, ssize_t
   }
 }
 
-void SplitRunsByFont(ListOfRuns &runs, const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index) {
-  RunSplitter splitter{runs};
+void SplitRunsByFont(ListOfRuns &runs, const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index, ListOfRuns *spare_runs) {
+  RunSplitter splitter{runs, spare_runs};
 
   auto current_attributes_run = FirstRunAfter(text_block, paragraph_start_index);
   auto attributes_run_end = text_block.attributes_runs().end();
@@ -166,7 +190,8 @@ void SplitRunsByFont(ListOfRuns &runs, const TextBlock &text_block, ssize_t para
   auto font_size = current_attributes_run->attributes.font_size;
 
   ++current_attributes_run;
-  for (; current_attributes_run != attributes_run_end && current_attributes_run->end <= paragraph_end_index; ++current_attributes_run) {
+  // the last attributes run might go on after the end of the paragraph (or of the part of it split)
+  for (; current_attributes_run != attributes_run_end && current_attributes_run->start < paragraph_end_index; ++current_attributes_run) {
     if (!IsFontSizeSimilar(current_attributes_run->attributes.font_size, font_size)
         || current_attributes_run->attributes.font_descriptor != font_descriptor) {
       splitter.RunGoesTo(current_attributes_run->start, [&](auto &run) {
@@ -183,38 +208,34 @@ void SplitRunsByFont(ListOfRuns &runs, const TextBlock &text_block, ssize_t para
   });
 }
 
-struct BidiVisualRun {
-  UBiDiDirection direction;
-  int32_t visual_index, logical_start, length;
-};
-void SplitRunsByDirection(ListOfRuns &runs, const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index) {
-  RunSplitter splitter{runs};
+void SplitRunsByDirection(ListOfRuns &runs, SplitRunsStorage &storage, const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index, UBiDiLevel paragraph_level) {
+  RunSplitter splitter{runs, &storage.spare_runs};
   int32_t length = int32_t(paragraph_end_index - paragraph_start_index);
 
   UErrorCode error_code = U_ZERO_ERROR;
-  UBiDi *bidi = ubidi_openSized(length, 0, &error_code);
-  assert(bidi != nullptr && U_SUCCESS(error_code));
-  AT_SCOPE_EXIT([&] {
-    ubidi_close(bidi);
-  });
-
-  ubidi_setPara(bidi, text_block.text_content()+paragraph_start_index, length, UBIDI_DEFAULT_LTR, nullptr, &error_code);
+  if (storage.bidi == nullptr) {
+    // its memory grows as needed
+    storage.bidi = ubidi_open();
+    assert(storage.bidi != nullptr);
+  }
+  auto bidi = storage.bidi;
+  ubidi_setPara(bidi, text_block.text_content()+paragraph_start_index, length, paragraph_level, nullptr, &error_code);
   assert(U_SUCCESS(error_code));
 
   auto paragraph_direction = ubidi_getDirection(bidi);
   if (paragraph_direction != UBIDI_MIXED) {
-    int bidi_visual_index = 0;
+    // a single bidi run, as when the runs of a bidi run of a mixed paragraph are split by language or font (in right-to-left text the last one logically is on the left)
     splitter.RunGoesTo(paragraph_end_index, [&](auto &run) {
       run.bidi_direction = paragraph_direction;
-      run.bidi_visual_index = bidi_visual_index++;
+      run.bidi_visual_index = 0;
     });
     return;
   }
 
   auto runs_count = ubidi_countRuns(bidi, &error_code);
   assert(U_SUCCESS(error_code));
-  std::vector<BidiVisualRun> bidi_runs;
-  bidi_runs.reserve(runs_count);
+  auto &bidi_runs = storage.bidi_runs;
+  bidi_runs.clear();
   for (int32_t run_index = 0; run_index < runs_count; ++run_index) {
     BidiVisualRun bidi_run;
     bidi_run.visual_index = run_index;
@@ -233,8 +254,8 @@ void SplitRunsByDirection(ListOfRuns &runs, const TextBlock &text_block, ssize_t
   }
 }
 
-void SplitRunsInLines(ListOfRuns &runs, const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index) {
-  RunSplitter splitter{runs};
+void SplitRunsInLines(ListOfRuns &runs, const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index, ListOfRuns *spare_runs) {
+  RunSplitter splitter{runs, spare_runs};
   const uint16_t *text = text_block.text_content();
   auto current_index = paragraph_start_index;
   while (current_index < paragraph_end_index) {
@@ -248,33 +269,52 @@ void SplitRunsInLines(ListOfRuns &runs, const TextBlock &text_block, ssize_t par
   }
 }
 
-ListOfRuns CreateBaseListOfRunsForParagraph(ssize_t paragraph_start_index, ssize_t paragraph_end_index) {
-  ListOfRuns runs;
-
-  TextRun base_paragraph_run = {
+static TextRun BaseRunForParagraph(ssize_t paragraph_start_index, ssize_t paragraph_end_index) {
+  return TextRun{
     .start_index = paragraph_start_index,
     .end_index = paragraph_end_index,
+    .script = USCRIPT_COMMON,
     .end_of_line = false,
+    .bidi_direction = UBIDI_LTR,
+    .bidi_visual_index = 0,
   };
-  runs.push_back(base_paragraph_run);
+}
 
+ListOfRuns CreateBaseListOfRunsForParagraph(ssize_t paragraph_start_index, ssize_t paragraph_end_index) {
+  ListOfRuns runs;
+  runs.push_back(BaseRunForParagraph(paragraph_start_index, paragraph_end_index));
   return runs;
 }
 
 ListOfRuns SplitRuns(const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index) {
-  auto runs = CreateBaseListOfRunsForParagraph(paragraph_start_index, paragraph_end_index);
+  ListOfRuns runs;
+  SplitRunsStorage storage;
+  SplitRuns(runs, storage, text_block, paragraph_start_index, paragraph_end_index);
+  return runs;
+}
+
+void SplitRuns(ListOfRuns &runs, SplitRunsStorage &storage, const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index, UBiDiLevel paragraph_level) {
+  auto &spare_runs = storage.spare_runs;
+  spare_runs.splice(spare_runs.end(), runs);
+  if (spare_runs.empty()) {
+    runs.push_back(BaseRunForParagraph(paragraph_start_index, paragraph_end_index));
+  }
+  else {
+    runs.splice(runs.end(), spare_runs, spare_runs.begin());
+    runs.front() = BaseRunForParagraph(paragraph_start_index, paragraph_end_index);
+  }
   if (paragraph_start_index == paragraph_end_index) {
-    return runs;
+    // an empty paragraph still needs a font for the height of its line
+    SplitRunsByFont(runs, text_block, paragraph_start_index, paragraph_end_index, &spare_runs);
+    return;
   }
 
-  SplitRunsByLanguage(runs, text_block, paragraph_start_index, paragraph_end_index);
-  SplitRunsByFont(runs, text_block, paragraph_start_index, paragraph_end_index);
-  SplitRunsByDirection(runs, text_block, paragraph_start_index, paragraph_end_index);
+  SplitRunsByLanguage(runs, text_block, paragraph_start_index, paragraph_end_index, &spare_runs);
+  SplitRunsByFont(runs, text_block, paragraph_start_index, paragraph_end_index, &spare_runs);
+  SplitRunsByDirection(runs, storage, text_block, paragraph_start_index, paragraph_end_index, paragraph_level);
 
   // splitting in lines must be last to be sure runs with end_of_line set to true are not split or thrown away
-  SplitRunsInLines(runs, text_block, paragraph_start_index, paragraph_end_index);
-
-  return runs;
+  SplitRunsInLines(runs, text_block, paragraph_start_index, paragraph_end_index, &spare_runs);
 }
 
 }
@@ -25,12 +25,16 @@
 #include "text_block.hh"
 
 #include <unicode/ustring.h>
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <functional>
+#include <iterator>
 
 namespace glyphknit {
 
 void TextBlock::SetText(const uint16_t *utf16_text, const size_t utf16_length) {
+  RecordChange(Change{0, ssize_t(text_.size()), ssize_t(utf16_length)});
   text_.resize(utf16_length);
   std::copy(utf16_text, utf16_text+utf16_length, text_.begin());
 
@@ -40,11 +44,13 @@ void TextBlock::SetText(const uint16_t *utf16_text, const size_t utf16_length) {
 
 const uint32_t kReplacementCharacter = 0xfffd;
 void TextBlock::SetText(const char *utf8_text, const size_t utf8_length) {
+  auto old_length = ssize_t(text_.size());
   text_.resize(utf8_length);  // a UTF-16 string is always smaller than its UTF-8 equivalent (in code units of course, not necessarily in bytes)
   int32_t utf16_length;
   UErrorCode errorCode = U_ZERO_ERROR;
   u_strFromUTF8WithSub(text_.data(), int32_t(text_.capacity()), &utf16_length, utf8_text, int32_t(utf8_length), kReplacementCharacter, NULL, &errorCode);
   text_.resize(utf16_length);
+  RecordChange(Change{0, old_length, utf16_length});
 
   attributes_runs_.resize(1);
   attributes_runs_.front().end = utf16_length;
@@ -54,6 +60,65 @@ void TextBlock::SetText(const char *utf8_text) {
   SetText(utf8_text, std::strlen(utf8_text));
 }
 
+void TextBlock::ReplaceText(ssize_t start, ssize_t end, const uint16_t *utf16_text, size_t utf16_length) {
+  assert(start >= 0 && start <= end && end <= ssize_t(text_.size()));
+  text_.erase(text_.begin()+start, text_.begin()+end);
+  text_.insert(text_.begin()+start, utf16_text, utf16_text+utf16_length);
+  ssize_t inserted_end = start + ssize_t(utf16_length);
+  RecordChange(Change{start, end, inserted_end});
+
+  // a boundary between attributes runs inside the replaced text or just after its start goes after the inserted text
+  auto MoveBoundary = [&](ssize_t index) {
+    if (index < start || (index == start && start == 0)) {
+      return index;
+    }
+    if (index < end) {
+      return inserted_end;
+    }
+    return index + (inserted_end - end);
+  };
+  for (auto run = attributes_runs_.begin(); run != attributes_runs_.end(); ) {
+    run->start = (run == attributes_runs_.begin() ? 0 : MoveBoundary(run->start));
+    run->end = (std::next(run) == attributes_runs_.end() ? ssize_t(text_.size()) : MoveBoundary(run->end));
+    if (run->start == run->end && attributes_runs_.size() > 1) {
+      run = attributes_runs_.erase(run);
+    }
+    else {
+      ++run;
+    }
+  }
+  MergeAdjacentRunsWithSameAttributes();
+}
+
+void TextBlock::ReplaceText(ssize_t start, ssize_t end, const char *utf8_text) {
+  auto utf8_length = std::strlen(utf8_text);
+  std::vector<uint16_t> utf16_text(utf8_length);
+  int32_t utf16_length;
+  UErrorCode errorCode = U_ZERO_ERROR;
+  u_strFromUTF8WithSub(utf16_text.data(), int32_t(utf16_text.size()), &utf16_length, utf8_text, int32_t(utf8_length), kReplacementCharacter, NULL, &errorCode);
+  ReplaceText(start, end, utf16_text.data(), size_t(utf16_length));
+}
+
+TextBlock::Change TextBlock::Change::FollowedBy(const Change &next) const {
+  // end of the text changed by any of the two changes, in the text between the two changes
+  auto changed_end = std::max(new_end, next.old_end);
+  return Change{
+    .start = std::min(start, next.start),
+    .old_end = changed_end - new_end + old_end,
+    .new_end = changed_end - next.old_end + next.new_end,
+  };
+}
+
+const size_t kMaxRecordedChanges = 64;
+void TextBlock::RecordChange(const Change &change) {
+  if (changes_.size() < kMaxRecordedChanges) {
+    changes_.push_back(change);
+  }
+  else {
+    changes_.back() = changes_.back().FollowedBy(change);
+  }
+}
+
 TextBlock::~TextBlock() {
 }
 
@@ -78,6 +143,7 @@ void TextBlock::SetAttribute(T AllTextAttributes::*attribute, const T &value, Co
   if (start >= end) {
     return;
   }
+  RecordChange(Change{start, end, end});
 
   // std::list iterators are not invalidated if the current element is not deleted so we can modify the elements without too much of a problem
   auto attributes_runs_end = attributes_runs_.end();
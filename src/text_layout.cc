@@ -0,0 +1,67 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "text_layout.hh"
+#include "newline.hh"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+namespace glyphknit {
+
+TextLayout::TextLayout(Typesetter &typesetter, const TextBlock &text_block) : typesetter_(typesetter), text_block_(text_block) {
+  ParagraphIterator paragraph_iterator{text_block.text_content(), 0, text_block.text_length()};
+  for (auto paragraph = paragraph_iterator.FindNext(); paragraph.start < text_block.text_length(); paragraph = paragraph_iterator.FindNext()) {
+    paragraphs_.push_back(typesetter.ShapeParagraph(text_block, paragraph.start, paragraph.end));
+  }
+}
+
+TypesetLines TextLayout::PositionGlyphs(double available_width) {
+  TypesetLines typeset_lines;
+  for (const auto &paragraph : paragraphs_) {
+    auto paragraph_lines = typesetter_.PositionLines(text_block_, paragraph, typesetter_.BreakLines(text_block_, paragraph, available_width));
+    typeset_lines.insert(typeset_lines.end(), std::make_move_iterator(paragraph_lines.begin()), std::make_move_iterator(paragraph_lines.end()));
+  }
+  return typeset_lines;
+}
+
+TypesetLines TextLayout::PositionGlyphs(const std::vector<double> &line_widths) {
+  assert(!line_widths.empty());
+  return PositionGlyphs([&line_widths](size_t line_index) {
+    return line_widths[std::min(line_index, line_widths.size() - 1)];
+  });
+}
+
+TypesetLines TextLayout::PositionGlyphs(const LineWidthCallback &available_width_of_line) {
+  TypesetLines typeset_lines;
+  for (const auto &paragraph : paragraphs_) {
+    auto lines = typesetter_.BreakLines(text_block_, paragraph, available_width_of_line, typeset_lines.size());
+    auto paragraph_lines = typesetter_.PositionLines(text_block_, paragraph, lines);
+    typeset_lines.insert(typeset_lines.end(), std::make_move_iterator(paragraph_lines.begin()), std::make_move_iterator(paragraph_lines.end()));
+  }
+  return typeset_lines;
+}
+
+}
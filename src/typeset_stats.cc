@@ -0,0 +1,74 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "typeset_stats.hh"
+
+namespace glyphknit {
+
+const char *TypesetStats::PhaseName(Phase phase) {
+  switch (phase) {
+    case kFindBoundaries:
+      return "FindBoundaries";
+    case kSplitRuns:
+      return "SplitRuns";
+    case kFontFallback:
+      return "FontFallback";
+    case kShape:
+      return "Shape";
+    case kAnalyzeClusters:
+      return "AnalyzeClusters";
+    case kBreakLines:
+      return "BreakLines";
+    case kOutput:
+      return "Output";
+    case kCleanup:
+      return "Cleanup";
+    case kPhasesCount:
+      break;
+  }
+  return "unknown";
+}
+
+void TypesetStats::Reset() {
+  for (auto &nanoseconds : phase_nanoseconds) {
+    nanoseconds = 0;
+  }
+  paragraphs_count = 0;
+  shape_calls_count = 0;
+  max_shape_calls_per_paragraph = 0;
+  line_break_reshapes_count = 0;
+  safe_line_breaks_count = 0;
+  grapheme_cluster_breaks_count = 0;
+  fallback_retries_per_font.clear();
+}
+
+int64_t TypesetStats::total_nanoseconds() const {
+  int64_t total = 0;
+  for (auto nanoseconds : phase_nanoseconds) {
+    total += nanoseconds;
+  }
+  return total;
+}
+
+}
@@ -24,281 +24,606 @@
 
 #include "typesetter.hh"
 #include "at_scope_exit.hh"
-#include "autorelease.hh"
 #include "newline.hh"
 #include "split_runs.hh"
+#include "utf.hh"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <chrono>
 #include <cmath>
+#include <limits>
+#include <mutex>
 #include <unistd.h>
 #include <iostream>  // for debugging
 
 #include <hb-ot.h>
+#ifdef __APPLE__
+#include "autorelease.hh"
 #include <CoreText/CoreText.h>
+#endif
 
 namespace glyphknit {
 
-static ssize_t CountGraphemeClusters(UBreakIterator *grapheme_cluster_iterator, ssize_t start_offset, ssize_t end_offset) {
-  ssize_t grapheme_clusters_count = 0;
-  auto offset = start_offset;
-  while (offset < end_offset) {
-    offset = ubrk_following(grapheme_cluster_iterator, int32_t(offset));
-    ++grapheme_clusters_count;
+// adds the time spent until it is destroyed (or stopped) to a phase of the statistics
+// does nothing when statistics are not gathered
+class PhaseTimer {
+ public:
+  typedef std::chrono::steady_clock Clock;
+
+  PhaseTimer(TypesetStats *stats, TypesetStats::Phase phase) : stats_{stats}, phase_{phase} {
+    if (stats_ != nullptr) {
+      start_time_ = Clock::now();
+    }
   }
-  return grapheme_clusters_count;
+  PhaseTimer(const PhaseTimer &) = delete;
+  PhaseTimer &operator=(const PhaseTimer &) = delete;
+  ~PhaseTimer() { Stop(); }
+  void Stop() {
+    if (stats_ != nullptr) {
+      stats_->phase_nanoseconds[phase_] += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_time_).count();
+      stats_ = nullptr;
+    }
+  }
+
+ private:
+  TypesetStats *stats_;
+  TypesetStats::Phase phase_;
+  Clock::time_point start_time_;
+};
+
+static void RecordFallbackRetry(TypesetStats *stats, FontDescriptor font_descriptor) {
+  auto postscript_name = FT_Get_Postscript_Name(font_descriptor.GetFTFace());
+  ++stats->fallback_retries_per_font[postscript_name == nullptr ? "" : postscript_name];
 }
 
-void Typesetter::Shape(const TextBlock &text_block, ssize_t start_index, ssize_t end_index, FontDescriptor font_descriptor, Tag opentype_language_tag, UScriptCode script, UBiDiDirection bidi_direction) {
-  hb_buffer_clear_contents(hb_buffer_);
-  hb_buffer_add_utf16(hb_buffer_, text_block.text_content(), int32_t(text_block.text_length()), uint32_t(start_index), int32_t(end_index-start_index));
-  hb_buffer_set_direction(hb_buffer_, bidi_direction == UBIDI_RTL ? HB_DIRECTION_RTL : HB_DIRECTION_LTR);
-  hb_buffer_set_language(hb_buffer_, hb_ot_tag_to_language(opentype_language_tag));
-  if (script != USCRIPT_COMMON && script != USCRIPT_INHERITED) {
-    hb_buffer_set_script(hb_buffer_, hb_script_from_string(uscript_getShortName(script), -1));
+static bool FontCoversGraphemeCluster(FontDescriptor font_descriptor, const TextBlock &text_block, ssize_t cluster_start_index, ssize_t cluster_end_index) {
+  auto text = text_block.text_content();
+  for (auto index = cluster_start_index; index < cluster_end_index; ) {
+    auto codepoint = ConsumeCodepoint(text, cluster_end_index, index);
+    // default ignorable characters (joiners, variation selectors...) are not displayed so the font does not need to have them
+    if (!font_descriptor.CoversCharacter(codepoint) && !u_hasBinaryProperty(codepoint, UCHAR_DEFAULT_IGNORABLE_CODE_POINT)) {
+      return false;
+    }
   }
-  hb_shape(font_descriptor.GetHBFont(), hb_buffer_, nullptr, 0);
+  return true;
 }
 
-ssize_t Typesetter::CountGlyphsThatFit(const TextBlock &text_block, ssize_t width, bool start_of_line) {
-  auto glyphs_count = hb_buffer_get_length(hb_buffer_);
-  auto glyph_positions = hb_buffer_get_glyph_positions(hb_buffer_, nullptr);
-  auto glyph_infos = hb_buffer_get_glyph_infos(hb_buffer_, nullptr);
-  auto direction = hb_buffer_get_direction(hb_buffer_);
-
-  ssize_t glyphs_fitting_count = 0;
+// returns the first font of the fallback chain that can display the whole grapheme cluster
+static FontDescriptor FindFontCoveringGraphemeCluster(const TextRun &run, FontDescriptor requested_font_descriptor, const TextBlock &text_block, ssize_t cluster_start_index, ssize_t cluster_end_index, TypesetStats *stats) {
+  for (size_t font_fallback_index = 0; ; ++font_fallback_index) {
+    auto font_descriptor = requested_font_descriptor.GetFallback(font_fallback_index, run.language);
+    if (!font_descriptor.is_valid()) {
+      // none of the fallback fonts can display the characters so just use the main font's .notdef glyph
+      return requested_font_descriptor;
+    }
+    if (FontCoversGraphemeCluster(font_descriptor, text_block, cluster_start_index, cluster_end_index)) {
+      return font_descriptor;
+    }
+    if (stats != nullptr) {
+      RecordFallbackRetry(stats, font_descriptor);
+    }
+  }
+}
 
-  ssize_t x_position = 0;
+// the grapheme clusters and line break opportunities of the paragraph, using the line break rules of the language of each run
+static void FindParagraphBoundaries(ParagraphBoundaries &boundaries, LineBreakIterators &line_break_iterators, const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index, const ListOfRuns &runs) {
+  auto paragraph_text = text_block.text_content() + paragraph_start_index;
+  auto paragraph_length = paragraph_end_index - paragraph_start_index;
+  if (!boundaries.Find(paragraph_text, paragraph_length)) {
+    // the dictionaries are the same whatever the language
+    boundaries.FindLineBreakOpportunitiesWithIterator(paragraph_text, 0, paragraph_length, line_break_iterators.Get(kLanguageUnknown));
+  }
 
-  for (ssize_t relative_glyph_index = 0; relative_glyph_index < glyphs_count; ++relative_glyph_index) {
-    ssize_t glyph_index, previous_glyph_index, next_glyph_index;
-    if (HB_DIRECTION_IS_FORWARD(direction)) {
-      glyph_index = relative_glyph_index;
-      previous_glyph_index = glyph_index - 1;
-      next_glyph_index = glyph_index + 1;
+  // the text in languages with line break rules of their own (consecutive runs of the same language being done together)
+  for (auto run = runs.begin(); run != runs.end(); ) {
+    auto language = run->language;
+    auto start_index = run->start_index, end_index = run->end_index;
+    for (++run; run != runs.end() && run->start_index == end_index && run->language.language_code == language.language_code; ++run) {
+      end_index = run->end_index;
     }
-    else {
-      glyph_index = glyphs_count-relative_glyph_index-1;
-      previous_glyph_index = glyph_index + 1;
-      next_glyph_index = glyph_index - 1;
+    if (start_index < end_index && line_break_iterators.IsTailored(language)) {
+      boundaries.FindLineBreakOpportunitiesWithIterator(paragraph_text, start_index - paragraph_start_index, end_index - paragraph_start_index, line_break_iterators.Get(language));
     }
-    assert(relative_glyph_index == 0 || glyph_infos[previous_glyph_index].cluster <= glyph_infos[glyph_index].cluster);  // if it's not the case we need to reorder the clusters just after shaping
-
-    if (relative_glyph_index > 0 || !start_of_line) {  // the first glyph of a line always fits
-      uint32_t current_glyph_cluster = glyph_infos[glyph_index].cluster;
-      bool at_start_of_cluster = (relative_glyph_index == 0 || glyph_infos[previous_glyph_index].cluster != current_glyph_cluster);
-      bool at_end_of_cluster = (relative_glyph_index == glyphs_count - 1 || glyph_infos[next_glyph_index].cluster != current_glyph_cluster);
-      // u_isWhitespace does not include no-break spaces because they must be handled as non-spacing characters at the end of a line
-      bool width_ignored_if_end_of_line = (at_start_of_cluster && at_end_of_cluster && u_isWhitespace(GetCodepoint(text_block.text_content(), text_block.text_length(), current_glyph_cluster)));
+  }
+}
 
-      if (!width_ignored_if_end_of_line && x_position + glyph_positions[glyph_index].x_advance > width) {
-        return glyphs_fitting_count;
+// font itemization: splits the runs so that each grapheme cluster gets the first font of the fallback chain able to display it,
+// that way each part only has to be shaped once
+static void SplitRunsByFontCoverage(ListOfRuns &runs, ListOfRuns &spare_runs, const TextBlock &text_block, ssize_t paragraph_start_index, const ParagraphBoundaries &boundaries, TypesetStats *stats) {
+  for (auto run = runs.begin(); run != runs.end(); ++run) {
+    auto requested_font_descriptor = run->font_descriptor;
+    auto run_end_index = run->end_index;
+    for (auto cluster_start_index = run->start_index; cluster_start_index < run_end_index; ) {
+      auto cluster_end_index = std::min(run_end_index, boundaries.NextGraphemeClusterBoundary(cluster_start_index - paragraph_start_index) + paragraph_start_index);
+      auto font_descriptor = FindFontCoveringGraphemeCluster(*run, requested_font_descriptor, text_block, cluster_start_index, cluster_end_index, stats);
+      if (cluster_start_index == run->start_index) {
+        run->font_descriptor = font_descriptor;
       }
+      else if (font_descriptor != run->font_descriptor) {
+        ListOfRuns::iterator previous_part;
+        if (spare_runs.empty()) {
+          previous_part = runs.insert(run, *run);
+        }
+        else {
+          runs.splice(run, spare_runs, spare_runs.begin());
+          previous_part = std::prev(run);
+          *previous_part = *run;
+        }
+        previous_part->end_index = cluster_start_index;
+        previous_part->end_of_line = false;
+        run->start_index = cluster_start_index;
+        run->font_descriptor = font_descriptor;
+      }
+      cluster_start_index = cluster_end_index;
     }
-    ++glyphs_fitting_count;
-    x_position += glyph_positions[glyph_index].x_advance;
   }
-  return glyphs_fitting_count;
 }
 
-ssize_t Typesetter::FindTextOffsetAfterGlyphCluster(ssize_t glyph_index, ssize_t paragraph_end_index) {
-  auto glyphs_count = hb_buffer_get_length(hb_buffer_);
-  auto glyph_infos = hb_buffer_get_glyph_infos(hb_buffer_, nullptr);
-  auto direction = hb_buffer_get_direction(hb_buffer_);
+// going through the script's name each time a run is shaped would be slow so it is only done once for all scripts
+static hb_script_t GetHarfBuzzScript(UScriptCode script) {
+  static const auto kHarfBuzzScripts = [] {
+    std::array<hb_script_t, USCRIPT_CODE_LIMIT> harfbuzz_scripts;
+    for (int script_code = 0; script_code < USCRIPT_CODE_LIMIT; ++script_code) {
+      auto short_name = uscript_getShortName(UScriptCode(script_code));
+      harfbuzz_scripts[script_code] = (short_name == nullptr ? HB_SCRIPT_INVALID : hb_script_from_string(short_name, -1));
+    }
+    // for common and inherited, the script is not set so that HarfBuzz uses the default shaper
+    harfbuzz_scripts[USCRIPT_COMMON] = HB_SCRIPT_INVALID;
+    harfbuzz_scripts[USCRIPT_INHERITED] = HB_SCRIPT_INVALID;
+    return harfbuzz_scripts;
+  }();
+  if (script < 0 || script >= USCRIPT_CODE_LIMIT) {
+    return HB_SCRIPT_INVALID;
+  }
+  return kHarfBuzzScripts[script];
+}
 
-  ssize_t glyph_cluster = glyph_infos[glyph_index].cluster;
-  if (HB_DIRECTION_IS_FORWARD(direction)) {
-    for (ssize_t compared_glyph_index = glyph_index+1; compared_glyph_index < glyphs_count; ++compared_glyph_index) {
-      if (glyph_cluster != glyph_infos[compared_glyph_index].cluster) {
-        return glyph_infos[compared_glyph_index].cluster;
-      }
+// The hb_buffers of the Typesetters destroyed are kept for the next ones, with the memory they allocated,
+// so that creating a short-lived Typesetter to lay out a few labels is cheap.
+static const size_t kMaxPooledHarfBuzzBuffers = 8;
+static std::mutex harfbuzz_buffers_pool_mutex;
+static std::vector<hb_buffer_t *> *harfbuzz_buffers_pool = nullptr;
+
+static hb_buffer_t *AcquireHarfBuzzBuffer() {
+  {
+    std::lock_guard<std::mutex> lock{harfbuzz_buffers_pool_mutex};
+    if (harfbuzz_buffers_pool != nullptr && !harfbuzz_buffers_pool->empty()) {
+      auto buffer = harfbuzz_buffers_pool->back();
+      harfbuzz_buffers_pool->pop_back();
+      return buffer;
     }
   }
-  else {
-    for (ssize_t compared_glyph_index = glyph_index-1; compared_glyph_index >= 0; --compared_glyph_index) {
-      if (glyph_cluster != glyph_infos[compared_glyph_index].cluster) {
-        return glyph_infos[compared_glyph_index].cluster;
-      }
+  return hb_buffer_create();
+}
+
+static void ReleaseHarfBuzzBuffer(hb_buffer_t *buffer) {
+  hb_buffer_clear_contents(buffer);
+  {
+    std::lock_guard<std::mutex> lock{harfbuzz_buffers_pool_mutex};
+    if (harfbuzz_buffers_pool == nullptr) {
+      harfbuzz_buffers_pool = new std::vector<hb_buffer_t *>;
+      harfbuzz_buffers_pool->reserve(kMaxPooledHarfBuzzBuffers);
+    }
+    if (harfbuzz_buffers_pool->size() < kMaxPooledHarfBuzzBuffers) {
+      harfbuzz_buffers_pool->push_back(buffer);
+      return;
     }
   }
-  return paragraph_end_index;
+  hb_buffer_destroy(buffer);
 }
 
-ssize_t Typesetter::PreviousBreak(ssize_t index, ssize_t paragraph_start_index) {
-  do {
-    index = ubrk_preceding(line_break_iterator_, int32_t(index-paragraph_start_index)) + paragraph_start_index;
-    // ignore line break boundaries that are not at grapheme cluster boundary
-    // (for example between space and a combining mark)
-  } while (!ubrk_isBoundary(grapheme_cluster_iterator_, int32_t(index-paragraph_start_index)));
-  return index;
+hb_language_t Typesetter::GetHarfBuzzLanguage(Tag opentype_language_tag) {
+  auto found = harfbuzz_languages_.find(opentype_language_tag);
+  if (found != harfbuzz_languages_.end()) {
+    return found->second;
+  }
+  auto harfbuzz_language = hb_ot_tag_to_language(opentype_language_tag);
+  harfbuzz_languages_.emplace(opentype_language_tag, harfbuzz_language);
+  return harfbuzz_language;
 }
 
-TypesetLines Typesetter::TypesetParagraph(const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index, double available_width) {
-  TypesetLines typeset_lines;
-  double current_text_width = 0;
-
-  UErrorCode status = U_ZERO_ERROR;
-  ubrk_setText(line_break_iterator_, text_block.text_content()+paragraph_start_index, int32_t(paragraph_end_index-paragraph_start_index), &status);
-  assert(U_SUCCESS(status));
-  ubrk_setText(grapheme_cluster_iterator_, text_block.text_content()+paragraph_start_index, int32_t(paragraph_end_index-paragraph_start_index), &status);
-  assert(U_SUCCESS(status));
-
-  bool broke_line = false;
-
-  bool has_saved_line_break = false;
-  // all the saves_xxxx variables below do not need to be initialized but they are to silence the compiler
-  bool saved_at_end_of_run = false;
-  ListOfRuns::iterator saved_run;
-  ssize_t saved_start_index = 0;
-  ssize_t saved_line_break_point_index = 0;
-  ssize_t saved_line_runs_size = 0;
-  double saved_text_width = 0;
-
-  auto StartNewLine = [&]() {
-    typeset_lines.emplace_back();
-    current_text_width = 0;
-    has_saved_line_break = false;
-    broke_line = false;
-  };
+// same as hb_shape, but with a shape plan cached by the font
+static void ShapeBuffer(hb_buffer_t *buffer, FontDescriptor font_descriptor) {
+  hb_segment_properties_t segment_properties;
+  hb_buffer_get_segment_properties(buffer, &segment_properties);
+  auto shaped = hb_shape_plan_execute(font_descriptor.GetShapePlan(segment_properties), font_descriptor.GetHBFont(), buffer, nullptr, 0);
+  assert(shaped);
+  (void)shaped;  // only used by the assert
+  hb_buffer_set_content_type(buffer, HB_BUFFER_CONTENT_TYPE_GLYPHS);
+}
+
+void Typesetter::Shape(const TextBlock &text_block, ssize_t start_index, ssize_t end_index, FontDescriptor font_descriptor, Tag opentype_language_tag, UScriptCode script, UBiDiDirection bidi_direction) {
+  PhaseTimer timer{stats_, TypesetStats::kShape};
+  if (stats_ != nullptr) {
+    ++stats_->shape_calls_count;
+  }
+  hb_buffer_clear_contents(hb_buffer_);
+  hb_buffer_set_direction(hb_buffer_, bidi_direction == UBIDI_RTL ? HB_DIRECTION_RTL : HB_DIRECTION_LTR);
+  hb_buffer_set_language(hb_buffer_, GetHarfBuzzLanguage(opentype_language_tag));
+  hb_buffer_set_script(hb_buffer_, GetHarfBuzzScript(script));
+  if (start_index == end_index) {
+    return;
+  }
+  if (shaping_cache_ != nullptr) {
+    ShapeWithCache(text_block, start_index, end_index, font_descriptor);
+    return;
+  }
 
-  StartNewLine();
+  hb_buffer_add_utf16(hb_buffer_, text_block.text_content(), int32_t(text_block.text_length()), uint32_t(start_index), int32_t(end_index-start_index));
+  ShapeBuffer(hb_buffer_, font_descriptor);
+}
 
-  auto runs = SplitRuns(text_block, paragraph_start_index, paragraph_end_index);
-  auto runs_end = runs.end();
-  for (auto current_run = runs.begin(); current_run != runs_end; ++current_run) {
-    ssize_t current_start_index = current_run->start_index;
-    ssize_t current_end_index = current_run->end_index;
-    int bidi_visual_subindex = (current_run->bidi_direction == UBIDI_RTL ? -1 : 1);
-    int font_fallback_index = 0;
-reshape_part_of_run:
-    auto previous_text_width = current_text_width;
-    auto font_descriptor = current_run->font_descriptor.GetFallback(font_fallback_index, current_run->language);
-    Shape(text_block, current_start_index, current_end_index, font_descriptor, current_run->language.opentype_tag, current_run->script, current_run->bidi_direction);
+// Shapes separately each segment finishing by a space, getting the result from the cache when possible.
+// The results are then put together in hb_buffer_ as if the whole text had been shaped at once.
+// Each segment being shaped without its surrounding context, kerning or ligatures across spaces are lost.
+void Typesetter::ShapeWithCache(const TextBlock &text_block, ssize_t start_index, ssize_t end_index, FontDescriptor font_descriptor) {
+  hb_segment_properties_t segment_properties;
+  hb_buffer_get_segment_properties(hb_buffer_, &segment_properties);
+  if (segment_hb_buffer_ == nullptr) {
+    segment_hb_buffer_ = AcquireHarfBuzzBuffer();
+  }
 
-    auto glyphs_count = hb_buffer_get_length(hb_buffer_);
-    auto glyph_infos = hb_buffer_get_glyph_infos(hb_buffer_, nullptr);
-    auto direction = hb_buffer_get_direction(hb_buffer_);
-
-    // font fallback handling
-    for (ssize_t glyph_index = 0; glyph_index < glyphs_count; ++glyph_index) {
-      if (glyph_infos[glyph_index].codepoint == 0) { // no glyph for that character could be found in the font
-        if (glyph_infos[glyph_index].cluster == current_start_index) {
-          for (glyph_index = 0; glyph_index < glyphs_count; ++glyph_index) {
-            if (glyph_infos[glyph_index].codepoint != 0) {
-              current_end_index = glyph_infos[glyph_index].cluster;
-              break;
-            }
-          }  // if no character had any glyph found, current_end_index does not need to be changed
-          ++font_fallback_index;
-          goto reshape_part_of_run;
-        }
-        else {
-          current_end_index = glyph_infos[glyph_index].cluster;
-          goto reshape_part_of_run;
-        }
+  const uint16_t *text = text_block.text_content();
+  shaped_segments_.clear();
+  shaped_glyphs_.clear();
+  ssize_t segment_start_index = start_index;
+  while (segment_start_index < end_index) {
+    auto segment_end_index = segment_start_index;
+    while (segment_end_index < end_index && text[segment_end_index++] != ' ') {
+    }
+    auto segment_length = size_t(segment_end_index - segment_start_index);
+
+    auto glyphs = shaping_cache_->Find(font_descriptor, segment_properties, text + segment_start_index, segment_length);
+    if (glyphs == nullptr) {
+      hb_buffer_clear_contents(segment_hb_buffer_);
+      hb_buffer_set_segment_properties(segment_hb_buffer_, &segment_properties);
+      bool cacheable = (segment_length <= ShapingCache::kMaxSegmentLength);
+      if (cacheable) {
+        hb_buffer_add_utf16(segment_hb_buffer_, text + segment_start_index, int32_t(segment_length), 0, int32_t(segment_length));
+      }
+      else {
+        // long segments are not cached so they can be shaped in their context
+        hb_buffer_add_utf16(segment_hb_buffer_, text, int32_t(text_block.text_length()), uint32_t(segment_start_index), int32_t(segment_length));
+      }
+      ShapeBuffer(segment_hb_buffer_, font_descriptor);
+
+      auto glyphs_count = hb_buffer_get_length(segment_hb_buffer_);
+      auto glyph_infos = hb_buffer_get_glyph_infos(segment_hb_buffer_, nullptr);
+      auto glyph_positions = hb_buffer_get_glyph_positions(segment_hb_buffer_, nullptr);
+      auto cluster_base = (cacheable ? 0 : uint32_t(segment_start_index));
+      ShapingCache::Glyphs &shaped_glyphs = (cacheable ? new_cache_glyphs_ : uncached_glyphs_);
+      shaped_glyphs.clear();
+      for (size_t glyph_index = 0; glyph_index < glyphs_count; ++glyph_index) {
+        shaped_glyphs.push_back(ShapingCache::Glyph{
+          .id = uint16_t(glyph_infos[glyph_index].codepoint),
+          .cluster_delta = uint32_t(glyph_infos[glyph_index].cluster - cluster_base),
+          .x_advance = glyph_positions[glyph_index].x_advance,
+          .y_advance = glyph_positions[glyph_index].y_advance,
+          .x_offset = glyph_positions[glyph_index].x_offset,
+          .y_offset = glyph_positions[glyph_index].y_offset,
+        });
       }
+      glyphs = &shaped_glyphs;
     }
-    font_fallback_index = 0;
+    shaped_segments_.push_back(ShapedSegment{segment_start_index, shaped_glyphs_.size(), glyphs->size()});
+    shaped_glyphs_.insert(shaped_glyphs_.end(), glyphs->begin(), glyphs->end());
+    if (glyphs == &new_cache_glyphs_) {
+      // added after the copy as it might evict the glyphs of previous segments
+      shaping_cache_->Add(font_descriptor, segment_properties, text + segment_start_index, segment_length, std::move(new_cache_glyphs_));
+    }
+    segment_start_index = segment_end_index;
+  }
 
-    const ssize_t width_in_font_units = PixelsToFontUnits(available_width, font_descriptor, current_run->font_size);
-    const ssize_t current_x_position_in_font_units = PixelsToFontUnits(current_text_width, font_descriptor, current_run->font_size);
-    auto fitting_glyphs_count = CountGlyphsThatFit(text_block, width_in_font_units - current_x_position_in_font_units, current_x_position_in_font_units == 0);
+  hb_buffer_set_length(hb_buffer_, uint32_t(shaped_glyphs_.size()));
+  auto glyph_infos = hb_buffer_get_glyph_infos(hb_buffer_, nullptr);
+  auto glyph_positions = hb_buffer_get_glyph_positions(hb_buffer_, nullptr);
+  // glyphs in the buffer are in visual order, so for right-to-left text the last segment comes first
+  size_t glyph_index = 0;
+  auto output_segment = [&](const ShapedSegment &segment) {
+    for (size_t segment_glyph_index = 0; segment_glyph_index < segment.glyphs_count; ++segment_glyph_index) {
+      const auto &glyph = shaped_glyphs_[segment.first_glyph_index + segment_glyph_index];
+      glyph_infos[glyph_index].codepoint = glyph.id;
+      glyph_infos[glyph_index].cluster = uint32_t(segment.start_index + glyph.cluster_delta);
+      glyph_positions[glyph_index].x_advance = glyph.x_advance;
+      glyph_positions[glyph_index].y_advance = glyph.y_advance;
+      glyph_positions[glyph_index].x_offset = glyph.x_offset;
+      glyph_positions[glyph_index].y_offset = glyph.y_offset;
+      ++glyph_index;
+    }
+  };
+  if (HB_DIRECTION_IS_FORWARD(segment_properties.direction)) {
+    std::for_each(shaped_segments_.begin(), shaped_segments_.end(), output_segment);
+  }
+  else {
+    std::for_each(shaped_segments_.rbegin(), shaped_segments_.rend(), output_segment);
+  }
+  hb_buffer_set_content_type(hb_buffer_, HB_BUFFER_CONTENT_TYPE_GLYPHS);
+}
 
-    ssize_t break_offset;
-    if (fitting_glyphs_count == glyphs_count) {
-      break_offset = current_end_index;
+// HarfBuzz does not tell us where it is safe to break, so we consider that it is when:
+// - no glyph cluster crosses the break (checked by the caller)
+// - no character around the break takes a different form depending on its neighbors (like in Arabic)
+// - the glyphs around the break have their default advance and no offset (so no kerning has been applied)
+static bool IsSafeToBreak(const TextBlock &text_block, ssize_t break_offset, FontDescriptor font_descriptor, const ShapedParagraph::Glyph &glyph_before_break, const ShapedParagraph::Glyph &glyph_after_break) {
+  // cheapest checks first as it is done for every cluster
+  for (const auto *glyph : {&glyph_before_break, &glyph_after_break}) {
+    if (glyph->y_advance != 0 || glyph->x_offset != 0 || glyph->y_offset != 0) {
+      return false;
     }
-    else {
-      ssize_t glyph_index_after_fitting_glyphs;
-      if (HB_DIRECTION_IS_FORWARD(direction)) {
-        glyph_index_after_fitting_glyphs = fitting_glyphs_count;
+  }
+  const uint16_t *text = text_block.text_content();
+  ssize_t text_length = text_block.text_length();
+  for (auto c : {GetCodepoint(text, text_length, break_offset - 1), GetCodepoint(text, text_length, break_offset)}) {
+    if (u_getIntPropertyValue(c, UCHAR_JOINING_TYPE) != U_JT_NON_JOINING) {
+      return false;
+    }
+  }
+  for (const auto *glyph : {&glyph_before_break, &glyph_after_break}) {
+    if (glyph->x_advance != font_descriptor.GetNominalAdvance(glyph->id)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Adds the clusters of a run that has just been shaped, in logical order.
+// A glyph cluster made of multiple grapheme clusters (for example a ligature) gets split in one cluster per grapheme cluster
+// so that lines can be cut inside it when nothing else fits. How its advance is shared between them is guessed
+// from the advances of the characters taken separately, and the line is shaped again around the cut.
+void Typesetter::AddClusters(ShapedParagraph &paragraph, size_t run_index, const TextBlock &text_block) {
+  PhaseTimer timer{stats_, TypesetStats::kAnalyzeClusters};
+  auto &run = paragraph.runs_[run_index];
+  auto &clusters = paragraph.clusters_;
+  run.first_cluster_index = clusters.size();
+
+  const auto &glyphs = run.glyphs;
+  auto glyphs_count = glyphs.size();
+  bool is_forward = (run.bidi_direction != UBIDI_RTL);
+  auto GlyphIndex = [&](size_t relative_glyph_index) {
+    return is_forward ? relative_glyph_index : glyphs_count - relative_glyph_index - 1;
+  };
+  auto hb_font = run.font_descriptor.GetHBFont();
+  const uint16_t *text = text_block.text_content();
+  auto paragraph_start_index = paragraph.start_index_;
+
+  size_t relative_glyph_index = 0;
+  while (relative_glyph_index < glyphs_count) {
+    const auto &first_glyph = glyphs[GlyphIndex(relative_glyph_index)];
+    ssize_t cluster_start_index = first_glyph.cluster;
+    hb_position_t advance = 0;
+    auto relative_end_glyph_index = relative_glyph_index;
+    ssize_t cluster_end_index;
+    // a glyph cluster ending inside a grapheme cluster (for example a letter followed by a zero width joiner,
+    // or the first of a pair of regional indicators) is merged with the following ones so that lines are never cut inside a grapheme cluster
+    do {
+      auto glyph_cluster = glyphs[GlyphIndex(relative_end_glyph_index)].cluster;
+      while (relative_end_glyph_index < glyphs_count && glyphs[GlyphIndex(relative_end_glyph_index)].cluster == glyph_cluster) {
+        advance += glyphs[GlyphIndex(relative_end_glyph_index)].x_advance;
+        ++relative_end_glyph_index;
       }
-      else {
-        glyph_index_after_fitting_glyphs = glyphs_count - fitting_glyphs_count - 1;
+      cluster_end_index = (relative_end_glyph_index < glyphs_count ? ssize_t(glyphs[GlyphIndex(relative_end_glyph_index)].cluster) : run.end_index);
+      assert(cluster_end_index > cluster_start_index);  // if it's not the case we need to reorder the clusters just after shaping
+    } while (cluster_end_index < run.end_index && !boundaries_.IsGraphemeClusterBoundary(cluster_end_index - paragraph_start_index));
+
+    ShapedParagraph::Cluster cluster = {
+      .start_index = cluster_start_index,
+      .run_index = uint32_t(run_index),
+      .glyph_index = uint32_t(is_forward ? relative_glyph_index : glyphs_count - relative_end_glyph_index),
+      .glyphs_count = uint32_t(relative_end_glyph_index - relative_glyph_index),
+      .flags = 0,
+    };
+    if (relative_glyph_index == 0 || IsSafeToBreak(text_block, cluster_start_index, run.font_descriptor, glyphs[GlyphIndex(relative_glyph_index - 1)], first_glyph)) {
+      cluster.flags |= ShapedParagraph::kSafeToBreak;
+    }
+    if (boundaries_.IsLineBreakOpportunity(cluster_start_index - paragraph_start_index)) {
+      cluster.flags |= ShapedParagraph::kLineBreakOpportunity;
+    }
+
+    // a glyph cluster of only one character cannot contain multiple grapheme clusters
+    ssize_t grapheme_cluster_end_index = cluster_start_index;
+    ConsumeCodepoint(text, cluster_end_index, grapheme_cluster_end_index);
+    if (grapheme_cluster_end_index < cluster_end_index) {
+      grapheme_cluster_end_index = paragraph_start_index + boundaries_.NextGraphemeClusterBoundary(cluster_start_index - paragraph_start_index);
+    }
+    if (grapheme_cluster_end_index >= cluster_end_index) {
+      if (cluster.glyphs_count == 1 && boundaries_.IsWhitespace(cluster_start_index - paragraph_start_index)) {
+        cluster.flags |= ShapedParagraph::kHangingWhitespace;
       }
-      ssize_t offset_after_fitting_glyphs = glyph_infos[glyph_index_after_fitting_glyphs].cluster;
-      ssize_t offset_after_not_fitting_glyph_cluster = FindTextOffsetAfterGlyphCluster(glyph_index_after_fitting_glyphs, paragraph_end_index);
-
-      break_offset = PreviousBreak(offset_after_not_fitting_glyph_cluster, paragraph_start_index);
-      broke_line = true;
-
-      if (break_offset <= current_start_index) {
-        if (has_saved_line_break) {
-          has_saved_line_break = false;
-          auto &typeset_line = typeset_lines.back();
-          current_run = saved_run;
-          if (saved_at_end_of_run) {
-            typeset_line.runs.erase(typeset_line.runs.begin()+saved_line_runs_size, typeset_line.runs.end());
-            StartNewLine();
-            continue;
-          }
-          else {
-            typeset_line.runs.erase(typeset_line.runs.begin()+(saved_line_runs_size-1), typeset_line.runs.end());
-            current_start_index = saved_start_index;
-            current_end_index = saved_line_break_point_index;
-            current_text_width = saved_text_width;
-            goto reshape_part_of_run;
-          }
+      cluster.advance = FontUnitsToPixels(advance, run.font_descriptor, run.font_size);
+      clusters.push_back(cluster);
+    }
+    else {
+      hb_position_t advance_left = advance;
+      auto index = cluster_start_index;
+      while (true) {
+        hb_position_t grapheme_cluster_advance = 0;
+        while (index < grapheme_cluster_end_index) {
+          hb_codepoint_t glyph;
+          hb_font_get_glyph(hb_font, hb_codepoint_t(ConsumeCodepoint(text, grapheme_cluster_end_index, index)), 0, &glyph);  // .notdef if not found
+          grapheme_cluster_advance += run.font_descriptor.GetNominalAdvance(glyph);
         }
-        // no line break boundary can fit, so we have to cut by grapheme cluster
-        auto grapheme_clusters_count = CountGraphemeClusters(grapheme_cluster_iterator_, offset_after_fitting_glyphs-paragraph_start_index, offset_after_not_fitting_glyph_cluster-paragraph_start_index);
-        if (grapheme_clusters_count == 1) {
-          break_offset = offset_after_fitting_glyphs;
+        bool is_last = (grapheme_cluster_end_index >= cluster_end_index);
+        if (is_last || grapheme_cluster_advance > advance_left) {
+          grapheme_cluster_advance = advance_left;
         }
-        else {
-          // we have to retry shaping with just a part of the glyph cluster as that might fit
-          current_end_index = ubrk_preceding(grapheme_cluster_iterator_, int32_t(offset_after_not_fitting_glyph_cluster-paragraph_start_index));
-          goto reshape_part_of_run;
+        cluster.advance = FontUnitsToPixels(grapheme_cluster_advance, run.font_descriptor, run.font_size);
+        clusters.push_back(cluster);
+        advance_left -= grapheme_cluster_advance;
+        if (is_last) {
+          break;
         }
+
+        // the following grapheme clusters do not have glyphs of their own, and breaking before them is never safe
+        cluster.start_index = grapheme_cluster_end_index;
+        cluster.glyphs_count = 0;
+        cluster.flags = (boundaries_.IsLineBreakOpportunity(cluster.start_index - paragraph_start_index) ? ShapedParagraph::kLineBreakOpportunity : 0);
+        grapheme_cluster_end_index = std::min(cluster_end_index, paragraph_start_index + boundaries_.NextGraphemeClusterBoundary(cluster.start_index - paragraph_start_index));
       }
-      else {
-        assert(break_offset <= offset_after_fitting_glyphs);  // if it is possible to have a line breakable in the middle of a glyph cluster, we would have to retry shaping with just a part of the glyph cluster
-      }
+    }
+    relative_glyph_index = relative_end_glyph_index;
+  }
+}
+
+ShapedParagraph Typesetter::ShapeParagraph(const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index) {
+  ShapedParagraph paragraph;
+  ShapeParagraph(paragraph, text_block, paragraph_start_index, paragraph_end_index);
+  return paragraph;
+}
+
+// the memory used by the paragraph given (glyphs of its runs, clusters) is reused
+void Typesetter::ShapeParagraph(ShapedParagraph &paragraph, const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index, UBiDiLevel paragraph_level) {
+  paragraph.start_index_ = paragraph_start_index;
+  paragraph.end_index_ = paragraph_end_index;
+  paragraph.clusters_.clear();
+
+  PhaseTimer split_runs_timer{stats_, TypesetStats::kSplitRuns};
+  auto &runs = split_runs_;
+  SplitRuns(runs, split_runs_storage_, text_block, paragraph_start_index, paragraph_end_index, paragraph_level);
+  split_runs_timer.Stop();
+
+  PhaseTimer boundaries_timer{stats_, TypesetStats::kFindBoundaries};
+  FindParagraphBoundaries(boundaries_, line_break_iterators_, text_block, paragraph_start_index, paragraph_end_index, runs);
+  boundaries_timer.Stop();
 
-      // reshape with the break offset found
-      Shape(text_block, current_start_index, break_offset, font_descriptor, current_run->language.opentype_tag, current_run->script, current_run->bidi_direction);
+  PhaseTimer fallback_timer{stats_, TypesetStats::kFontFallback};
+  SplitRunsByFontCoverage(runs, split_runs_storage_.spare_runs, text_block, paragraph_start_index, boundaries_, stats_);
+  fallback_timer.Stop();
+
+  // the glyphs of the runs not needed anymore are kept for the following paragraphs,
+  // in reverse order so that a run index always gets back the same memory
+  for (auto run_index = paragraph.runs_.size(); run_index > runs.size(); --run_index) {
+    spare_glyphs_.push_back(std::move(paragraph.runs_[run_index - 1].glyphs));
+  }
+  auto previous_runs_count = paragraph.runs_.size();
+  paragraph.runs_.resize(runs.size());
+  for (auto run_index = previous_runs_count; run_index < paragraph.runs_.size() && !spare_glyphs_.empty(); ++run_index) {
+    paragraph.runs_[run_index].glyphs = std::move(spare_glyphs_.back());
+    spare_glyphs_.pop_back();
+  }
+  size_t run_index = 0;
+  for (const auto &text_run : runs) {
+    auto &run = paragraph.runs_[run_index];
+    run.start_index = text_run.start_index;
+    run.end_index = text_run.end_index;
+    run.font_descriptor = text_run.font_descriptor;
+    run.font_size = text_run.font_size;
+    run.opentype_language_tag = text_run.language.opentype_tag;
+    run.script = text_run.script;
+    run.bidi_direction = text_run.bidi_direction;
+    run.bidi_visual_index = text_run.bidi_visual_index;
+    run.end_of_line = text_run.end_of_line;
+    run.glyphs.clear();
+    if (run.start_index < run.end_index) {
+      Shape(text_block, run.start_index, run.end_index, run.font_descriptor, run.opentype_language_tag, run.script, run.bidi_direction);
+      auto glyphs_count = hb_buffer_get_length(hb_buffer_);
+      auto glyph_infos = hb_buffer_get_glyph_infos(hb_buffer_, nullptr);
+      auto glyph_positions = hb_buffer_get_glyph_positions(hb_buffer_, nullptr);
+      run.glyphs.resize(glyphs_count);
+      for (unsigned int glyph_index = 0; glyph_index < glyphs_count; ++glyph_index) {
+        run.glyphs[glyph_index] = ShapedParagraph::Glyph{
+          .id = uint16_t(glyph_infos[glyph_index].codepoint),
+          .cluster = glyph_infos[glyph_index].cluster,
+          .x_advance = glyph_positions[glyph_index].x_advance,
+          .y_advance = glyph_positions[glyph_index].y_advance,
+          .x_offset = glyph_positions[glyph_index].x_offset,
+          .y_offset = glyph_positions[glyph_index].y_offset,
+        };
+      }
     }
+    AddClusters(paragraph, run_index, text_block);
+    ++run_index;
+  }
+}
+
+// outputs the part [start_index, end_index) of a run, reusing its shaping when it is safe to cut it there
+void Typesetter::OutputRunPart(TypesetLine &typeset_line, const TextBlock &text_block, const ShapedParagraph &paragraph, size_t run_index, ssize_t start_index, ssize_t end_index, int bidi_visual_subindex) {
+  const auto &run = paragraph.runs_[run_index];
+  if (start_index == run.start_index && end_index == run.end_index) {
+    OutputShape(typeset_line, run, bidi_visual_subindex, run.glyphs.data(), run.glyphs.size());
+    return;
+  }
 
-    OutputShape(typeset_lines, current_text_width, font_descriptor, current_run->font_size, current_run->bidi_direction, current_run->bidi_visual_index, bidi_visual_subindex);
-    if (bidi_visual_subindex < 0) {
-      --bidi_visual_subindex;
+  const auto &clusters = paragraph.clusters_;
+  auto first_cluster_index = paragraph.FindCluster(run_index, start_index);
+  auto end_cluster_index = paragraph.FindCluster(run_index, end_index);
+  bool safe_start = (start_index == run.start_index || clusters[first_cluster_index].has_flag(ShapedParagraph::kSafeToBreak));
+  bool safe_end = (end_index == run.end_index || clusters[end_cluster_index].has_flag(ShapedParagraph::kSafeToBreak));
+  if (stats_ != nullptr && end_index < run.end_index && safe_end) {
+    ++stats_->safe_line_breaks_count;
+  }
+
+  if (safe_start && safe_end) {
+    // in the glyphs of the run, the clusters are in visual order so for right-to-left text the first one is at the end
+    size_t glyphs_start_index, glyphs_end_index;
+    if (run.bidi_direction != UBIDI_RTL) {
+      glyphs_start_index = clusters[first_cluster_index].glyph_index;
+      glyphs_end_index = (end_index == run.end_index ? run.glyphs.size() : clusters[end_cluster_index].glyph_index);
     }
     else {
-      ++bidi_visual_subindex;
+      glyphs_start_index = (end_index == run.end_index ? 0 : clusters[end_cluster_index].glyph_index + clusters[end_cluster_index].glyphs_count);
+      glyphs_end_index = clusters[first_cluster_index].glyph_index + clusters[first_cluster_index].glyphs_count;
     }
+    OutputShape(typeset_line, run, bidi_visual_subindex, run.glyphs.data() + glyphs_start_index, glyphs_end_index - glyphs_start_index);
+    return;
+  }
 
-    if (break_offset < current_run->end_index) {
-      if (broke_line) {
-        StartNewLine();
-      }
-      current_start_index = break_offset;
-      current_end_index = current_run->end_index;
-      goto reshape_part_of_run;
-    }
+  if (stats_ != nullptr) {
+    ++stats_->line_break_reshapes_count;
+  }
+  Shape(text_block, start_index, end_index, run.font_descriptor, run.opentype_language_tag, run.script, run.bidi_direction);
+  auto glyphs_count = hb_buffer_get_length(hb_buffer_);
+  auto glyph_infos = hb_buffer_get_glyph_infos(hb_buffer_, nullptr);
+  auto glyph_positions = hb_buffer_get_glyph_positions(hb_buffer_, nullptr);
+  reshaped_glyphs_.resize(glyphs_count);
+  for (unsigned int glyph_index = 0; glyph_index < glyphs_count; ++glyph_index) {
+    reshaped_glyphs_[glyph_index] = ShapedParagraph::Glyph{
+      .id = uint16_t(glyph_infos[glyph_index].codepoint),
+      .cluster = glyph_infos[glyph_index].cluster,
+      .x_advance = glyph_positions[glyph_index].x_advance,
+      .y_advance = glyph_positions[glyph_index].y_advance,
+      .x_offset = glyph_positions[glyph_index].x_offset,
+      .y_offset = glyph_positions[glyph_index].y_offset,
+    };
+  }
+  OutputShape(typeset_line, run, bidi_visual_subindex, reshaped_glyphs_.data(), reshaped_glyphs_.size());
+}
+
+TypesetLines Typesetter::PositionLines(const TextBlock &text_block, const ShapedParagraph &paragraph, const ShapedParagraph::Lines &lines) {
+  TypesetLines typeset_lines;
+  typeset_lines.reserve(lines.size());
 
-    if (current_run->end_of_line) {
-      StartNewLine();
+  const auto &runs = paragraph.runs_;
+  for (const auto &line : lines) {
+    // the numbering is restarted on each line so that the lines can be positioned separately
+    int bidi_visual_subindex = 0;
+    size_t previous_run_index = runs.size();
+    typeset_lines.emplace_back();
+    auto &typeset_line = typeset_lines.back();
+    if (stats_ != nullptr && line.emergency_break) {
+      ++stats_->grapheme_cluster_breaks_count;
     }
-    else {
-      // save the last braking point in case we have to go back to it later
-      auto &typeset_line = typeset_lines.back();
-      if (ubrk_isBoundary(line_break_iterator_, int32_t(current_end_index-paragraph_start_index))
-          && ubrk_isBoundary(grapheme_cluster_iterator_, int32_t(current_end_index-paragraph_start_index))) {
-        has_saved_line_break = true;
-        saved_at_end_of_run = true;
-        saved_run = current_run;
-        saved_line_runs_size = typeset_line.runs.size();
+
+    for (auto run_index = line.first_run_index; run_index < line.end_run_index; ++run_index) {
+      const auto &run = runs[run_index];
+      auto start_index = std::max(run.start_index, line.start_index);
+      auto end_index = std::min(run.end_index, line.end_index);
+      if (start_index >= end_index && run.start_index < run.end_index) {
+        continue;
+      }
+      if (run_index != previous_run_index) {
+        if (previous_run_index == runs.size() || runs[run_index - 1].bidi_visual_index != run.bidi_visual_index) {
+          bidi_visual_subindex = (run.bidi_direction == UBIDI_RTL ? -1 : 1);
+        }  // else continue the numbering of the previous run as they end up in the same bidi run (for example after font fallback)
+        previous_run_index = run_index;
+      }
+      OutputRunPart(typeset_line, text_block, paragraph, run_index, start_index, end_index, bidi_visual_subindex);
+      if (bidi_visual_subindex < 0) {
+        --bidi_visual_subindex;
       }
       else {
-        ssize_t possible_break_index = PreviousBreak(current_end_index, paragraph_start_index);
-        if (possible_break_index > current_start_index && possible_break_index < current_end_index) {
-          has_saved_line_break = true;
-          saved_at_end_of_run = false;
-          saved_run = current_run;
-          saved_start_index = current_start_index;
-          saved_line_break_point_index = possible_break_index;
-          saved_line_runs_size = typeset_line.runs.size();
-          saved_text_width = previous_text_width;
-        }
+        ++bidi_visual_subindex;
       }
     }
   }
@@ -307,6 +632,7 @@ reshape_part_of_run:
   // - reorder BiDi runs
   // - empty runs are removed
   // - if 2 runs have a different script but end up with the same font, we have to merge them
+  PhaseTimer cleanup_timer{stats_, TypesetStats::kCleanup};
   for (auto &line : typeset_lines) {
     std::sort(line.runs.begin(), line.runs.end(), [](const auto &run_a, const auto &run_b) {
       if (run_a.bidi_visual_index == run_b.bidi_visual_index) {
@@ -338,49 +664,174 @@ reshape_part_of_run:
       }
     }
   }
+  cleanup_timer.Stop();
 
   return typeset_lines;
 }
 
-void Typesetter::OutputShape(TypesetLines &typeset_lines, double &current_text_width, FontDescriptor font_descriptor, float font_size, UBiDiDirection bidi_direction, int bidi_visual_index, int bidi_visual_subindex) {
-  auto glyphs_count = hb_buffer_get_length(hb_buffer_);
-  auto glyph_infos = hb_buffer_get_glyph_infos(hb_buffer_, nullptr);
-  auto glyph_pos = hb_buffer_get_glyph_positions(hb_buffer_, nullptr);
+// How the advance of a glyph cluster made of multiple grapheme clusters (for example a ligature) is shared between them is only guessed,
+// so a line starting or ending inside one is shaped to confirm that it fits (at most one confirmation for each line).
+// If it does not, the line ends one grapheme cluster earlier and the following lines are broken again greedily.
+bool Typesetter::ConfirmEmergencyBreak(const TextBlock &text_block, const ShapedParagraph &paragraph, const ShapedParagraph::LineWidthCallback &available_width_of_line, size_t line_index, ShapedParagraph::Line &line, size_t *next_line_first_run_index) {
+  const auto &runs = paragraph.runs_;
+  const auto &clusters = paragraph.clusters_;
+  if (line.first_run_index >= line.end_run_index) {
+    return false;
+  }
+  // only the grapheme clusters after the first one of a glyph cluster have no glyphs of their own
+  auto IsInsideGlyphCluster = [&](size_t run_index, ssize_t index) {
+    return index > runs[run_index].start_index && index < runs[run_index].end_index && clusters[paragraph.FindCluster(run_index, index)].glyphs_count == 0;
+  };
+  // how much wider the part [start_index, end_index) of a run is when shaped than what was guessed
+  auto ShapedWidthDifference = [&](size_t run_index, ssize_t start_index, ssize_t end_index) {
+    const auto &run = runs[run_index];
+    Shape(text_block, start_index, end_index, run.font_descriptor, run.opentype_language_tag, run.script, run.bidi_direction);
+    auto glyphs_count = hb_buffer_get_length(hb_buffer_);
+    auto glyph_positions = hb_buffer_get_glyph_positions(hb_buffer_, nullptr);
+    hb_position_t shaped_advance = 0;
+    for (unsigned int glyph_index = 0; glyph_index < glyphs_count; ++glyph_index) {
+      shaped_advance += glyph_positions[glyph_index].x_advance;
+    }
+    double guessed_width = 0;
+    for (auto cluster_index = paragraph.FindCluster(run_index, start_index); cluster_index < paragraph.FindCluster(run_index, end_index); ++cluster_index) {
+      guessed_width += clusters[cluster_index].advance;
+    }
+    return FontUnitsToPixels(shaped_advance, run.font_descriptor, run.font_size) - guessed_width;
+  };
+
+  auto first_run_index = line.first_run_index;
+  auto last_run_index = line.end_run_index - 1;
+  bool starts_inside = IsInsideGlyphCluster(first_run_index, line.start_index);
+  bool ends_inside = IsInsideGlyphCluster(last_run_index, line.end_index);
+  if (!starts_inside && !ends_inside) {
+    return false;
+  }
+
+  double width_difference = 0;
+  if (starts_inside) {
+    width_difference += ShapedWidthDifference(first_run_index, line.start_index, std::min(runs[first_run_index].end_index, line.end_index));
+  }
+  if (ends_inside && (!starts_inside || last_run_index != first_run_index)) {
+    width_difference += ShapedWidthDifference(last_run_index, std::max(runs[last_run_index].start_index, line.start_index), line.end_index);
+  }
+  auto end_cluster_index = paragraph.FindCluster(last_run_index, line.end_index);
+  if (line.width + width_difference <= available_width_of_line(line_index) || end_cluster_index <= paragraph.FindCluster(first_run_index, line.start_index) + 1) {
+    return false;
+  }
+
+  const auto &last_cluster = clusters[end_cluster_index - 1];
+  line.end_index = last_cluster.start_index;
+  line.end_run_index = last_cluster.run_index + (line.end_index > runs[last_cluster.run_index].start_index ? 1 : 0);
+  line.width -= last_cluster.advance;
+  line.emergency_break = true;
+  *next_line_first_run_index = last_cluster.run_index;
+  return true;
+}
+
+void Typesetter::ConfirmEmergencyBreaks(const TextBlock &text_block, const ShapedParagraph &paragraph, const ShapedParagraph::LineWidthCallback &available_width_of_line, size_t first_line_index, ShapedParagraph::Lines &lines) {
+  for (size_t line_index = 0; line_index < lines.size(); ++line_index) {
+    auto &line = lines[line_index];
+    size_t next_line_first_run_index;
+    if (ConfirmEmergencyBreak(text_block, paragraph, available_width_of_line, first_line_index + line_index, line, &next_line_first_run_index)) {
+      auto next_line_start_index = line.end_index;
+      lines.resize(line_index + 1);
+      paragraph.BreakLinesFrom(lines, available_width_of_line, first_line_index + line_index + 1, next_line_start_index, next_line_first_run_index, nullptr);
+    }
+  }
+}
+
+// with the line breaking chosen (the memory of the lines given is reused by the greedy line breaking)
+void Typesetter::BreakLines(const TextBlock &text_block, const ShapedParagraph &paragraph, double available_width, ShapedParagraph::Lines &lines) {
+  PhaseTimer timer{stats_, TypesetStats::kBreakLines};
+  auto available_width_of_line = [available_width](size_t) { return available_width; };
+  if (balanced_line_breaking_) {
+    lines = paragraph.BreakLinesBalanced(available_width);
+  }
+  else if (optimal_line_breaking_ != nullptr) {
+    lines = paragraph.BreakLinesOptimally(available_width, *optimal_line_breaking_);
+  }
+  else {
+    lines.clear();
+    paragraph.BreakLinesFrom(lines, available_width_of_line, 0, paragraph.runs_.empty() ? paragraph.start_index_ : paragraph.runs_.front().start_index, 0, nullptr);
+  }
+  ConfirmEmergencyBreaks(text_block, paragraph, available_width_of_line, 0, lines);
+}
+
+ShapedParagraph::Lines Typesetter::BreakLines(const TextBlock &text_block, const ShapedParagraph &paragraph, double available_width) {
+  ShapedParagraph::Lines lines;
+  BreakLines(text_block, paragraph, available_width, lines);
+  return lines;
+}
+
+ShapedParagraph::Lines Typesetter::BreakLines(const TextBlock &text_block, const ShapedParagraph &paragraph, const ShapedParagraph::LineWidthCallback &available_width_of_line, size_t first_line_index) {
+  PhaseTimer timer{stats_, TypesetStats::kBreakLines};
+  auto lines = paragraph.BreakLines(available_width_of_line, first_line_index);
+  ConfirmEmergencyBreaks(text_block, paragraph, available_width_of_line, first_line_index, lines);
+  return lines;
+}
+
+ShapedParagraph::Lines Typesetter::BreakLinesAgain(const TextBlock &text_block, const ShapedParagraph &paragraph, double available_width, const ShapedParagraph &previous, const ShapedParagraph::Lines &previous_lines, ShapedParagraph::Reflow *reflow) {
+  PhaseTimer timer{stats_, TypesetStats::kBreakLines};
+  auto available_width_of_line = [available_width](size_t) { return available_width; };
+  return paragraph.BreakLinesAgain(available_width, previous, previous_lines, reflow, [&](ShapedParagraph::Line &line, size_t *next_line_first_run_index) {
+    return ConfirmEmergencyBreak(text_block, paragraph, available_width_of_line, 0, line, next_line_first_run_index);
+  });
+}
 
-  auto &last_line = typeset_lines.back();
-  last_line.runs.emplace_back();
-  auto &last_run = last_line.runs.back();
-  auto &glyphs = last_run.glyphs;
-  glyphs.resize(glyphs_count);
+TypesetLines Typesetter::TypesetParagraph(const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index, double available_width) {
+  const int64_t shape_calls_count_before = (stats_ == nullptr ? 0 : stats_->shape_calls_count);
 
-  last_run.font_size = font_size;
-  last_run.font_descriptor = font_descriptor;
+  auto paragraph = ShapeParagraph(text_block, paragraph_start_index, paragraph_end_index);
+  ShapedParagraph::Lines lines;
+  BreakLines(text_block, paragraph, available_width, lines);
+  auto typeset_lines = PositionLines(text_block, paragraph, lines);
 
-  last_run.bidi_direction = bidi_direction;
-  last_run.bidi_visual_index = bidi_visual_index;
-  last_run.bidi_visual_subindex = bidi_visual_subindex;
+  if (stats_ != nullptr) {
+    ++stats_->paragraphs_count;
+    stats_->max_shape_calls_per_paragraph = std::max(stats_->max_shape_calls_per_paragraph, stats_->shape_calls_count - shape_calls_count_before);
+  }
 
+  return typeset_lines;
+}
+
+// a line is as high as the highest of the fonts of its runs
+static void AddFontMetrics(Coordinate &line_ascent, Coordinate &line_descent, Coordinate &line_leading, FontDescriptor font_descriptor, float font_size) {
   auto ft_face = font_descriptor.GetFTFace();
-  CGFloat ascent = std::round(FontUnitsToPixels(ft_face->ascender, font_descriptor, font_size));
-  CGFloat descent = std::round(FontUnitsToPixels(std::abs(ft_face->descender), font_descriptor, font_size));
-  CGFloat leading = std::round(FontUnitsToPixels(ft_face->height - ft_face->ascender - std::abs(ft_face->descender), font_descriptor, font_size));
-  last_line.ascent = std::max(last_line.ascent, ascent);
-  last_line.descent = std::max(last_line.descent, descent);
-  last_line.leading = std::max(last_line.leading, leading);
-
-  ssize_t base_x = 0;
-  for (unsigned int glyph_index = 0; glyph_index < glyphs_count; ++glyph_index) {
-    auto &glyph = glyphs[glyph_index];
-    glyph.id = uint16_t(glyph_infos[glyph_index].codepoint);
-    glyph.x_advance = FontUnitsToPixels(glyph_pos[glyph_index].x_advance, font_descriptor, font_size);
-    glyph.y_advance = FontUnitsToPixels(glyph_pos[glyph_index].y_advance, font_descriptor, font_size);
-    glyph.x_offset = FontUnitsToPixels(glyph_pos[glyph_index].x_offset, font_descriptor, font_size);
-    glyph.y_offset = FontUnitsToPixels(glyph_pos[glyph_index].y_offset, font_descriptor, font_size);
-    glyph.offset = glyph_infos[glyph_index].cluster;
-    base_x += glyph_pos[glyph_index].x_advance;
+  Coordinate ascent = std::round(FontUnitsToPixels(ft_face->ascender, font_descriptor, font_size));
+  Coordinate descent = std::round(FontUnitsToPixels(std::abs(ft_face->descender), font_descriptor, font_size));
+  Coordinate leading = std::round(FontUnitsToPixels(ft_face->height - ft_face->ascender - std::abs(ft_face->descender), font_descriptor, font_size));
+  line_ascent = std::max(line_ascent, ascent);
+  line_descent = std::max(line_descent, descent);
+  line_leading = std::max(line_leading, leading);
+}
+
+void Typesetter::OutputShape(TypesetLine &typeset_line, const ShapedParagraph::Run &run, int bidi_visual_subindex, const ShapedParagraph::Glyph *glyphs, size_t glyphs_count) {
+  PhaseTimer timer{stats_, TypesetStats::kOutput};
+  auto font_descriptor = run.font_descriptor;
+  auto font_size = run.font_size;
+
+  typeset_line.runs.emplace_back();
+  auto &typeset_run = typeset_line.runs.back();
+  typeset_run.glyphs.resize(glyphs_count);
+
+  typeset_run.font_size = font_size;
+  typeset_run.font_descriptor = font_descriptor;
+
+  typeset_run.bidi_direction = run.bidi_direction;
+  typeset_run.bidi_visual_index = run.bidi_visual_index;
+  typeset_run.bidi_visual_subindex = bidi_visual_subindex;
+
+  AddFontMetrics(typeset_line.ascent, typeset_line.descent, typeset_line.leading, font_descriptor, font_size);
+
+  for (size_t glyph_index = 0; glyph_index < glyphs_count; ++glyph_index) {
+    auto &glyph = typeset_run.glyphs[glyph_index];
+    glyph.id = glyphs[glyph_index].id;
+    glyph.x_advance = FontUnitsToPixels(glyphs[glyph_index].x_advance, font_descriptor, font_size);
+    glyph.y_advance = FontUnitsToPixels(glyphs[glyph_index].y_advance, font_descriptor, font_size);
+    glyph.x_offset = FontUnitsToPixels(glyphs[glyph_index].x_offset, font_descriptor, font_size);
+    glyph.y_offset = FontUnitsToPixels(glyphs[glyph_index].y_offset, font_descriptor, font_size);
+    glyph.offset = glyphs[glyph_index].cluster;
   }
-  const auto upem = hb_face_get_upem(hb_font_get_face(font_descriptor.GetHBFont()));
-  current_text_width += double(base_x) * font_size / upem;
 }
 
 TypesetLines Typesetter::PositionGlyphs(TextBlock &text_block, double available_width) {
@@ -394,6 +845,346 @@ TypesetLines Typesetter::PositionGlyphs(TextBlock &text_block, double available_
   return typeset_lines;
 }
 
+// the smallest font size of the text, to estimate how much of it lines can hold
+static float SmallestFontSize(const TextBlock &text_block) {
+  float font_size = std::numeric_limits<float>::infinity();
+  for (const auto &attributes_run : text_block.attributes_runs()) {
+    font_size = std::min(font_size, attributes_run.attributes.font_size);
+  }
+  return std::max(font_size, 1.0f);
+}
+
+// end of a part of the paragraph containing at least the text of lines_count lines (characters are rarely narrower than a quarter of an em)
+static ssize_t EstimateEndOfLines(const TextBlock &text_block, ssize_t paragraph_start_index, ssize_t paragraph_end_index, double lines_count, double available_width, float font_size) {
+  double characters_per_line = std::max(1.0, available_width / (0.25 * font_size));
+  double length = characters_per_line * lines_count;
+  if (length >= double(paragraph_end_index - paragraph_start_index)) {
+    return paragraph_end_index;
+  }
+  auto end_index = paragraph_start_index + std::max(ssize_t(length), ssize_t(1));
+  if (U16_IS_TRAIL(text_block.text_content()[end_index])) {
+    ++end_index;
+  }
+  return end_index;
+}
+
+// end of the start of the paragraph split last that is at the paragraph level: the bidi levels of the text after it might change with the text after the part split
+// (for example a space between right-to-left text and a number is right-to-left in a left-to-right paragraph, but not if the number is not in the part)
+static ssize_t EndOfParagraphLevel(UBiDi *bidi, ssize_t paragraph_start_index) {
+  int32_t logical_limit;
+  UBiDiLevel level;
+  ubidi_getLogicalRun(bidi, 0, &logical_limit, &level);
+  return (level == ubidi_getParaLevel(bidi) ? paragraph_start_index + logical_limit : paragraph_start_index);
+}
+
+TypesetLines Typesetter::PositionGlyphs(TextBlock &text_block, double available_width, const LayoutLimits &limits, bool *truncated) {
+  TypesetLines typeset_lines;
+  Coordinate height = 0;
+  const uint16_t *text = text_block.text_content();
+  ssize_t text_length = text_block.text_length();
+  float smallest_font_size = SmallestFontSize(text_block);
+  // the greedy line breaking only looks at the text of a line to break it, so only the start of a paragraph has to be shaped to get its first lines
+  bool break_lines_greedily = (!balanced_line_breaking_ && optimal_line_breaking_ == nullptr);
+
+  ShapedParagraph shaped_paragraph;
+  ShapedParagraph::Lines lines;
+  // for the ellipsis, the last line laid out, and its paragraph when it is the last one of the previous paragraph
+  ShapedParagraph previous_shaped_paragraph;
+  ShapedParagraph::Line last_line;
+  bool limit_reached = false;
+  size_t paragraph_lines_count = 0;  // laid out
+
+  ssize_t paragraph_start_index = 0;
+  while (paragraph_start_index < text_length && !limit_reached) {
+    if (paragraph_lines_count > 0) {
+      std::swap(shaped_paragraph, previous_shaped_paragraph);
+    }
+    paragraph_lines_count = 0;
+    // the end of the paragraph is only looked for in the text shaped, so that the rest of a long paragraph is never looked at
+    ssize_t paragraph_end_index = text_length;
+    bool paragraph_end_found = false;
+    ssize_t shaped_end_index = paragraph_start_index;
+    bool shaped_to_end = false;
+    // the lines are broken from where the lines laid out end, as more of the paragraph might not be broken in as many lines before
+    size_t next_line_index = 0;  // the first one not laid out
+    size_t usable_lines_count = 0;  // the lines at the end of a part of the paragraph might change with the text after it
+    // where the lines laid out end, and the run the following line starts in (the same in all the shapings of the paragraph as the text before the line does not change)
+    ssize_t next_line_start_index = paragraph_start_index;
+    size_t next_line_first_run_index = 0;
+    // the direction of the whole paragraph, as it might come from text after the part shaped
+    UBiDiLevel paragraph_level = UBIDI_DEFAULT_LTR;
+    // also once text not at the paragraph level has been shaped, as its bidi levels might change with the text after the part shaped
+    bool shape_to_paragraph_end = !break_lines_greedily;
+    const int64_t shape_calls_count_before = (stats_ == nullptr ? 0 : stats_->shape_calls_count);
+    if (stats_ != nullptr) {
+      ++stats_->paragraphs_count;
+    }
+
+    while (true) {
+      bool all_shaped_lines_used = (next_line_index >= usable_lines_count);
+      if (all_shaped_lines_used && shaped_to_end) {
+        break;
+      }
+      size_t lines_left = limits.max_lines - typeset_lines.size();
+      if (limits.max_height < std::numeric_limits<Coordinate>::infinity()) {
+        double lines_left_in_height = double(limits.max_height - height) / double(smallest_font_size);
+        if (lines_left_in_height < double(lines_left)) {
+          lines_left = size_t(lines_left_in_height) + 1;
+        }
+      }
+      if (lines_left == 0) {
+        limit_reached = true;
+        break;
+      }
+
+      if (all_shaped_lines_used) {
+        if (shaped_end_index > paragraph_start_index) {
+          assert(next_line_index < lines.size());
+          next_line_start_index = lines[next_line_index].start_index;
+          next_line_first_run_index = lines[next_line_index].first_run_index;
+        }
+        // at least twice more text each time so that the paragraph is not shaped too many times (and two more lines as the last ones are not usable)
+        ssize_t end_index = paragraph_end_index;
+        if (!shape_to_paragraph_end) {
+          end_index = std::min(paragraph_end_index, std::max(EstimateEndOfLines(text_block, next_line_start_index, text_length, double(lines_left) + 2, available_width, smallest_font_size),
+                                                             shaped_end_index + (shaped_end_index - paragraph_start_index)));
+        }
+        if (!paragraph_end_found) {
+          auto paragraph = ParagraphIterator{text, shaped_end_index, end_index}.FindNext();
+          if (paragraph.end < end_index || end_index == text_length) {
+            paragraph_end_index = paragraph.end;
+            paragraph_end_found = true;
+          }
+          end_index = paragraph.end;
+        }
+        if (!paragraph_end_found && paragraph_level == UBIDI_DEFAULT_LTR) {
+          // it is the one of the first strong character, so the rest of the paragraph is only looked at when there is none before
+          auto direction = ubidi_getBaseDirection(text + paragraph_start_index, int32_t(end_index - paragraph_start_index));
+          if (direction == UBIDI_NEUTRAL) {
+            paragraph_end_index = ParagraphIterator{text, end_index, text_length}.FindNext().end;
+            paragraph_end_found = true;
+            direction = ubidi_getBaseDirection(text + end_index, int32_t(paragraph_end_index - end_index));
+          }
+          paragraph_level = (direction == UBIDI_RTL ? 1 : 0);
+        }
+        ShapeParagraph(shaped_paragraph, text_block, paragraph_start_index, end_index, paragraph_level);
+        shaped_end_index = end_index;
+        shaped_to_end = (paragraph_end_found && end_index == paragraph_end_index);
+        if (next_line_start_index == paragraph_start_index) {
+          BreakLines(text_block, shaped_paragraph, available_width, lines);
+        }
+        else {
+          PhaseTimer timer{stats_, TypesetStats::kBreakLines};
+          auto available_width_of_line = [available_width](size_t) { return available_width; };
+          lines.clear();
+          shaped_paragraph.BreakLinesFrom(lines, available_width_of_line, 0, next_line_start_index, next_line_first_run_index, nullptr);
+          ConfirmEmergencyBreaks(text_block, shaped_paragraph, available_width_of_line, 0, lines);
+        }
+        next_line_index = 0;
+        usable_lines_count = lines.size();
+        if (!shaped_to_end) {
+          // the lines ending before the end of the part (its last line might change with the text after it), and before text whose bidi levels might change
+          auto usable_end_index = std::min(shaped_end_index - 1, EndOfParagraphLevel(split_runs_storage_.bidi, paragraph_start_index));
+          if (usable_end_index < shaped_end_index - 1) {
+            shape_to_paragraph_end = true;
+          }
+          while (usable_lines_count > 0 && lines[usable_lines_count - 1].end_index > usable_end_index) {
+            --usable_lines_count;
+          }
+          // but where a line ends also depends on the start of the next line (the cluster that did not fit might be kerned with the text after it)
+          if (usable_lines_count > 0) {
+            --usable_lines_count;
+          }
+        }
+        continue;
+      }
+
+      auto first_line = lines.begin() + ssize_t(next_line_index);
+      auto new_typeset_lines = PositionLines(text_block, shaped_paragraph, ShapedParagraph::Lines(first_line, first_line + ssize_t(std::min(usable_lines_count - next_line_index, lines_left))));
+      for (auto &typeset_line : new_typeset_lines) {
+        if (typeset_lines.size() == limits.max_lines || height + typeset_line.height() > limits.max_height) {
+          limit_reached = true;
+          break;
+        }
+        height += typeset_line.height();
+        typeset_lines.push_back(std::move(typeset_line));
+        last_line = lines[next_line_index];
+        ++next_line_index;
+        ++paragraph_lines_count;
+      }
+      if (limit_reached) {
+        break;
+      }
+    }
+    if (stats_ != nullptr) {
+      stats_->max_shape_calls_per_paragraph = std::max(stats_->max_shape_calls_per_paragraph, stats_->shape_calls_count - shape_calls_count_before);
+    }
+
+    // after the paragraph separator (CR+LF being a single one)
+    paragraph_start_index = paragraph_end_index + 1;
+    if (paragraph_end_index + 1 < text_length && text[paragraph_end_index] == '\r' && text[paragraph_end_index + 1] == '\n') {
+      ++paragraph_start_index;
+    }
+  }
+
+  *truncated = limit_reached;
+  if (limit_reached && limits.ellipsis && !typeset_lines.empty()) {
+    ReplaceWithEllipsizedLine(typeset_lines.back(), text_block, paragraph_lines_count > 0 ? shaped_paragraph : previous_shaped_paragraph, last_line, available_width);
+  }
+  return typeset_lines;
+}
+
+// lays out again the line, cut at the last grapheme cluster boundary leaving enough space for an ellipsis after it
+void Typesetter::ReplaceWithEllipsizedLine(TypesetLine &typeset_line, const TextBlock &text_block, const ShapedParagraph &paragraph, const ShapedParagraph::Line &line, double available_width) {
+  const auto &runs = paragraph.runs_;
+  const auto &clusters = paragraph.clusters_;
+  assert(!runs.empty());
+  auto first_cluster_index = (line.first_run_index < runs.size() ? paragraph.FindCluster(line.first_run_index, line.start_index) : clusters.size());
+  auto end_cluster_index = (line.end_run_index > line.first_run_index ? paragraph.FindCluster(line.end_run_index - 1, line.end_index) : first_cluster_index);
+
+  // the ellipsis uses the font of the end of the line (three full stops if the font does not have an ellipsis)
+  const auto &ellipsis_run = runs[end_cluster_index > first_cluster_index ? clusters[end_cluster_index - 1].run_index : std::min(line.first_run_index, runs.size() - 1)];
+  auto font_descriptor = ellipsis_run.font_descriptor;
+  hb_codepoint_t ellipsis_glyph;
+  size_t ellipsis_glyphs_count = 1;
+  if (!hb_font_get_glyph(font_descriptor.GetHBFont(), 0x2026, 0, &ellipsis_glyph)) {  // HORIZONTAL ELLIPSIS
+    hb_font_get_glyph(font_descriptor.GetHBFont(), '.', 0, &ellipsis_glyph);
+    ellipsis_glyphs_count = 3;
+  }
+  Coordinate ellipsis_glyph_advance = FontUnitsToPixels(font_descriptor.GetNominalAdvance(ellipsis_glyph), font_descriptor, ellipsis_run.font_size);
+  double ellipsis_width = double(ellipsis_glyphs_count) * ellipsis_glyph_advance;
+
+  ShapedParagraph::Line ellipsized_line = line;
+  ellipsized_line.end_index = line.start_index;
+  ellipsized_line.end_run_index = line.first_run_index;
+  ellipsized_line.width = 0;
+  ellipsized_line.emergency_break = false;
+  double width = 0;
+  for (auto cluster_index = first_cluster_index; cluster_index < end_cluster_index; ++cluster_index) {
+    const auto &cluster = clusters[cluster_index];
+    width += cluster.advance;
+    if (cluster.has_flag(ShapedParagraph::kHangingWhitespace)) {
+      continue;
+    }
+    if (width + ellipsis_width > available_width) {
+      break;
+    }
+    ellipsized_line.end_index = (cluster_index + 1 < paragraph.clusters_end_index(cluster.run_index) ? clusters[cluster_index + 1].start_index : runs[cluster.run_index].end_index);
+    ellipsized_line.end_run_index = cluster.run_index + 1;
+    ellipsized_line.width = width;
+  }
+  typeset_line = std::move(PositionLines(text_block, paragraph, ShapedParagraph::Lines{ellipsized_line}).front());
+
+  TypesetRun typeset_run;
+  typeset_run.font_descriptor = font_descriptor;
+  typeset_run.font_size = ellipsis_run.font_size;
+  typeset_run.bidi_direction = ellipsis_run.bidi_direction;
+  typeset_run.bidi_visual_index = ellipsis_run.bidi_visual_index;
+  typeset_run.bidi_visual_subindex = 0;
+  typeset_run.glyphs.assign(ellipsis_glyphs_count, TypesetRun::Glyph{
+    .id = GlyphId(ellipsis_glyph),
+    .x_offset = 0,
+    .y_offset = 0,
+    .x_advance = ellipsis_glyph_advance,
+    .y_advance = 0,
+    .offset = ellipsized_line.end_index,
+  });
+  AddFontMetrics(typeset_line.ascent, typeset_line.descent, typeset_line.leading, font_descriptor, ellipsis_run.font_size);
+  // next to the run holding the end of the text it follows (not always at one end of the line in mixed direction text),
+  // after it in left-to-right text and before it in right-to-left text, numbered so that the runs stay in visual order
+  auto end_run = typeset_line.runs.end();
+  TextOffset end_offset = -1;
+  for (auto run = typeset_line.runs.begin(); run != typeset_line.runs.end(); ++run) {
+    for (const auto &glyph : run->glyphs) {
+      if (glyph.offset > end_offset) {
+        end_offset = glyph.offset;
+        end_run = run;
+      }
+    }
+  }
+  if (end_run == typeset_line.runs.end()) {
+    typeset_line.runs.push_back(std::move(typeset_run));
+  }
+  else {
+    bool before = (end_run->bidi_direction == UBIDI_RTL);
+    typeset_run.bidi_direction = end_run->bidi_direction;
+    typeset_run.bidi_visual_index = end_run->bidi_visual_index;
+    typeset_run.bidi_visual_subindex = end_run->bidi_visual_subindex + (before ? -1 : 1);
+    typeset_line.runs.insert(before ? end_run : end_run + 1, std::move(typeset_run));
+  }
+}
+
+TextMetrics Typesetter::Measure(TextBlock &text_block, double available_width) {
+  TextMetrics metrics;
+  Measure(text_block, available_width, &metrics);
+  return metrics;
+}
+
+void Typesetter::Measure(TextBlock &text_block, double available_width, TextMetrics *metrics) {
+  metrics->lines.clear();
+  metrics->width = 0;
+  metrics->height = 0;
+
+  ParagraphIterator paragraph_iterator{text_block.text_content(), 0, text_block.text_length()};
+  for (auto paragraph = paragraph_iterator.FindNext(); paragraph.start < text_block.text_length(); paragraph = paragraph_iterator.FindNext()) {
+    ShapeParagraph(measured_paragraph_, text_block, paragraph.start, paragraph.end);
+    BreakLines(text_block, measured_paragraph_, available_width, measured_lines_);
+    if (stats_ != nullptr) {
+      ++stats_->paragraphs_count;
+    }
+
+    // the same runs as the ones PositionLines would output for each line
+    const auto &runs = measured_paragraph_.runs_;
+    const auto &clusters = measured_paragraph_.clusters_;
+    for (const auto &line : measured_lines_) {
+      LineMetrics line_metrics = {
+        .ascent = 0,
+        .descent = 0,
+        .leading = 0,
+        .width = line.width,
+      };
+      for (auto run_index = line.first_run_index; run_index < line.end_run_index; ++run_index) {
+        const auto &run = runs[run_index];
+        if (std::max(run.start_index, line.start_index) >= std::min(run.end_index, line.end_index) && run.start_index < run.end_index) {
+          continue;
+        }
+        AddFontMetrics(line_metrics.ascent, line_metrics.descent, line_metrics.leading, run.font_descriptor, run.font_size);
+      }
+
+      if (line.end_run_index > line.first_run_index) {
+        auto first_cluster_index = measured_paragraph_.FindCluster(line.first_run_index, line.start_index);
+        auto cluster_index = measured_paragraph_.FindCluster(line.end_run_index - 1, line.end_index);
+        for (; cluster_index > first_cluster_index && clusters[cluster_index - 1].has_flag(ShapedParagraph::kHangingWhitespace); --cluster_index) {
+          line_metrics.width -= clusters[cluster_index - 1].advance;
+        }
+      }
+
+      metrics->lines.push_back(line_metrics);
+      metrics->width = std::max(metrics->width, line_metrics.width);
+      metrics->height += line_metrics.height();
+    }
+  }
+}
+
+ShapedParagraph::IntrinsicWidths Typesetter::MeasureIntrinsicWidths(TextBlock &text_block) {
+  ShapedParagraph::IntrinsicWidths widths = {
+    .min_content = 0,
+    .max_content = 0,
+  };
+  ParagraphIterator paragraph_iterator{text_block.text_content(), 0, text_block.text_length()};
+  for (auto paragraph = paragraph_iterator.FindNext(); paragraph.start < text_block.text_length(); paragraph = paragraph_iterator.FindNext()) {
+    ShapeParagraph(measured_paragraph_, text_block, paragraph.start, paragraph.end);
+    if (stats_ != nullptr) {
+      ++stats_->paragraphs_count;
+    }
+    auto paragraph_widths = measured_paragraph_.FindIntrinsicWidths();
+    widths.min_content = std::max(widths.min_content, paragraph_widths.min_content);
+    widths.max_content = std::max(widths.max_content, paragraph_widths.max_content);
+  }
+  return widths;
+}
+
+#ifdef __APPLE__
 void Typesetter::DrawToContext(TextBlock &text_block, size_t available_width, CGContextRef context) {
   TypesetLines typeset_lines = PositionGlyphs(text_block, available_width);
 
@@ -429,21 +1220,23 @@ void Typesetter::DrawToContext(TextBlock &text_block, size_t available_width, CG
     previous_line = &line;
   }
 }
+#endif
 
+// the ICU line break iterators are only cloned when first needed (see LineBreakIterators)
 Typesetter::Typesetter() {
-  // TODO: maybe use a different line break iterator for each locale (at least for locales having a custom one)?
-  UErrorCode status = U_ZERO_ERROR;
-  line_break_iterator_ = ubrk_open(UBRK_LINE, "en", nullptr, 0, &status);
-  assert(U_SUCCESS(status));
-  grapheme_cluster_iterator_ = ubrk_open(UBRK_CHARACTER, "en", nullptr, 0, &status);
-  assert(U_SUCCESS(status));
-  hb_buffer_ = hb_buffer_create();
+  hb_buffer_ = AcquireHarfBuzzBuffer();
+  segment_hb_buffer_ = nullptr;
+  stats_ = nullptr;
+  shaping_cache_ = nullptr;
+  optimal_line_breaking_ = nullptr;
+  balanced_line_breaking_ = false;
 }
 
 Typesetter::~Typesetter() {
-  hb_buffer_destroy(hb_buffer_);
-  ubrk_close(grapheme_cluster_iterator_);
-  ubrk_close(line_break_iterator_);
+  if (segment_hb_buffer_ != nullptr) {
+    ReleaseHarfBuzzBuffer(segment_hb_buffer_);
+  }
+  ReleaseHarfBuzzBuffer(hb_buffer_);
 }
 
 }
@@ -26,6 +26,11 @@
 
 #include "test.h"
 
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#ifdef __APPLE__
 TEST(Font, FontFamilyClass) {
   using glyphknit::FontDescriptor;
   using glyphknit::FontManager;
@@ -54,3 +59,109 @@ TEST(Font, FontFamilyClass) {
   descriptor = FontManager::CreateDescriptorFromPostScriptName("Times-Roman");
   ASSERT_EQ(FontFamilyClass::kSerif, descriptor.font_family_class());
 }
+#endif
+
+// must be the first test to load DejaVu Sans to check anything
+TEST(Font, GetFallbackLoadedLater) {
+  using glyphknit::FontManager;
+  auto serif = FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSerif.ttf");
+#ifndef __APPLE__
+  ASSERT_EQ(FontManager::CreateDescriptorFromPostScriptName("DejaVuSans"), serif.GetFallback(1, glyphknit::kLanguageUnknown));
+  // the fallback chain already resolved does not prevent a font loaded later from being used
+  auto sans_serif = FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSans.ttf");
+  ASSERT_EQ(sans_serif, serif.GetFallback(1, glyphknit::kLanguageUnknown));
+#endif
+  ASSERT_EQ(serif, serif.GetFallback(0, glyphknit::kLanguageUnknown));
+}
+
+TEST(Font, CreateDescriptorFromLocalFile) {
+  using glyphknit::FontDescriptor;
+  using glyphknit::FontManager;
+  using glyphknit::FontFamilyClass;
+  auto descriptor = FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSerif.ttf");
+  ASSERT_TRUE(descriptor.is_valid());
+  ASSERT_STREQ("DejaVuSerif", FT_Get_Postscript_Name(descriptor.GetFTFace()));
+  ASSERT_EQ(FontFamilyClass::kSerif, descriptor.font_family_class());
+  ASSERT_EQ(descriptor, FontManager::CreateDescriptorFromPostScriptName("DejaVuSerif"));
+
+  ASSERT_FALSE(FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/does-not-exist.ttf").is_valid());
+  // DejaVu Serif is not a font collection
+  ASSERT_FALSE(FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSerif.ttf", 1).is_valid());
+  ASSERT_FALSE(FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSerif.ttf", -1).is_valid());
+}
+
+TEST(Font, CreateDescriptorFromMemory) {
+  using glyphknit::FontManager;
+  // must stay valid as long as the font is used
+  static std::vector<char> font_data;
+  std::ifstream file{GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSans.ttf", std::ios::binary};
+  font_data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  ASSERT_FALSE(font_data.empty());
+
+  auto descriptor = FontManager::CreateDescriptorFromMemory(font_data.data(), font_data.size());
+  ASSERT_TRUE(descriptor.is_valid());
+  ASSERT_STREQ("DejaVuSans", FT_Get_Postscript_Name(descriptor.GetFTFace()));
+  ASSERT_EQ(descriptor, FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSans.ttf"));
+
+  static const char kNotAFont[] = "not a font";
+  ASSERT_FALSE(FontManager::CreateDescriptorFromMemory(kNotAFont, sizeof(kNotAFont)).is_valid());
+  ASSERT_FALSE(FontManager::CreateDescriptorFromMemory(font_data.data(), font_data.size(), -1).is_valid());
+}
+
+TEST(Font, Interning) {
+  using glyphknit::FontManager;
+  auto descriptor = FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSansMono.ttf");
+  ASSERT_TRUE(descriptor.is_valid());
+  auto loaded_again = FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSansMono.ttf");
+  ASSERT_EQ(descriptor, loaded_again);
+  // the same face and HarfBuzz font are shared, so they do not have to be created again
+  ASSERT_EQ(descriptor.GetFTFace(), loaded_again.GetFTFace());
+  ASSERT_EQ(descriptor.GetHBFont(), FontManager::CreateDescriptorFromPostScriptName("DejaVuSansMono").GetHBFont());
+
+  auto other_font = FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSans.ttf");
+  ASSERT_NE(descriptor, other_font);
+  ASSERT_NE(descriptor, glyphknit::FontDescriptor{});
+}
+
+TEST(Font, GetFallback) {
+  using glyphknit::FontManager;
+  auto sans_serif = FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSans.ttf");
+  auto serif = FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSerif.ttf");
+  ASSERT_EQ(serif, serif.GetFallback(0, glyphknit::kLanguageUnknown));
+#ifndef __APPLE__
+  // DejaVu Serif itself is skipped, and only the DejaVu fonts are available
+  ASSERT_EQ(sans_serif, serif.GetFallback(1, glyphknit::kLanguageUnknown));
+  ASSERT_FALSE(serif.GetFallback(2, glyphknit::kLanguageUnknown).is_valid());
+  ASSERT_FALSE(sans_serif.GetFallback(1, glyphknit::kLanguageUnknown).is_valid());
+  auto japanese = glyphknit::FindLanguageCodeAndOpenTypeLanguageTag("ja");
+  ASSERT_EQ(sans_serif, serif.GetFallback(1, japanese));
+  ASSERT_FALSE(serif.GetFallback(2, japanese).is_valid());
+#endif
+  // asking again gives the same result
+  ASSERT_EQ(serif.GetFallback(1, glyphknit::kLanguageUnknown), serif.GetFallback(1, glyphknit::kLanguageUnknown));
+}
+
+TEST(Font, CoversCharacter) {
+  auto descriptor = glyphknit::FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSans.ttf");
+  ASSERT_TRUE(descriptor.CoversCharacter('a'));
+  ASSERT_TRUE(descriptor.CoversCharacter(0x00E9));  // é
+  ASSERT_TRUE(descriptor.CoversCharacter(0x05D0));  // hebrew alef
+  ASSERT_FALSE(descriptor.CoversCharacter(0x6F22));  // kanji
+  ASSERT_FALSE(descriptor.CoversCharacter(0x10FFFF));
+  ASSERT_FALSE(descriptor.CoversCharacter(-1));
+}
+
+TEST(Font, GetShapePlan) {
+  auto descriptor = glyphknit::FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSans.ttf");
+  hb_segment_properties_t latin_properties = HB_SEGMENT_PROPERTIES_DEFAULT;
+  latin_properties.direction = HB_DIRECTION_LTR;
+  latin_properties.script = HB_SCRIPT_LATIN;
+  latin_properties.language = hb_language_from_string("en", -1);
+  auto arabic_properties = latin_properties;
+  arabic_properties.direction = HB_DIRECTION_RTL;
+  arabic_properties.script = HB_SCRIPT_ARABIC;
+  auto latin_plan = descriptor.GetShapePlan(latin_properties);
+  ASSERT_NE(nullptr, latin_plan);
+  ASSERT_EQ(latin_plan, descriptor.GetShapePlan(latin_properties));
+  ASSERT_NE(latin_plan, descriptor.GetShapePlan(arabic_properties));
+}
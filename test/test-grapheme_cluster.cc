@@ -0,0 +1,168 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "grapheme_cluster.hh"
+
+#include "test.h"
+
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+#include <unicode/ubrk.h>
+#include <unicode/uchar.h>
+#include <unicode/ustring.h>
+
+// codepoints between U+D800 and U+DFFF are kept as lone surrogates
+static std::vector<uint16_t> ConvertToUTF16(const std::vector<UChar32> &codepoints) {
+  std::vector<uint16_t> text;
+  for (auto codepoint : codepoints) {
+    if (codepoint > 0xFFFF) {
+      text.push_back(U16_LEAD(codepoint));
+      text.push_back(U16_TRAIL(codepoint));
+    }
+    else {
+      text.push_back(uint16_t(codepoint));
+    }
+  }
+  return text;
+}
+
+static std::vector<uint64_t> FindWithIcu(UBreakIterator *grapheme_cluster_iterator, const std::vector<uint16_t> &text) {
+  std::vector<uint64_t> bits(text.size() / 64 + 1);
+  UErrorCode status = U_ZERO_ERROR;
+  ubrk_setText(grapheme_cluster_iterator, text.data(), int32_t(text.size()), &status);
+  EXPECT_TRUE(U_SUCCESS(status));
+  for (auto boundary = ubrk_first(grapheme_cluster_iterator); boundary != UBRK_DONE; boundary = ubrk_next(grapheme_cluster_iterator)) {
+    bits[size_t(boundary) / 64] |= uint64_t(1) << (size_t(boundary) % 64);
+  }
+  return bits;
+}
+
+static std::string Describe(const std::vector<UChar32> &codepoints) {
+  std::string description;
+  for (auto codepoint : codepoints) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%04X(%s) ", codepoint, u_getPropertyValueName(UCHAR_GRAPHEME_CLUSTER_BREAK, u_getIntPropertyValue(codepoint, UCHAR_GRAPHEME_CLUSTER_BREAK), U_SHORT_PROPERTY_NAME));
+    description += buffer;
+  }
+  return description;
+}
+
+static void ExpectSameAsIcu(UBreakIterator *grapheme_cluster_iterator, const std::vector<UChar32> &codepoints) {
+  auto text = ConvertToUTF16(codepoints);
+  std::vector<uint64_t> bits(text.size() / 64 + 1);
+  glyphknit::FindGraphemeClusterBoundaries(text.data(), ssize_t(text.size()), bits.data());
+  EXPECT_EQ(FindWithIcu(grapheme_cluster_iterator, text), bits) << Describe(codepoints);
+}
+
+// a few codepoints of each grapheme cluster break property, also separating the ones only concerned by some of the rules
+static std::vector<UChar32> FindSampleCodepoints() {
+  std::map<std::string, std::vector<UChar32>> codepoints_per_kind;
+  for (UChar32 codepoint = 0; codepoint <= 0x10FFFF; ++codepoint) {
+    auto grapheme_cluster_break = u_getIntPropertyValue(codepoint, UCHAR_GRAPHEME_CLUSTER_BREAK);
+    bool is_pictographic = u_hasBinaryProperty(codepoint, UCHAR_EXTENDED_PICTOGRAPHIC);
+    auto indic_syllabic_category = u_getIntPropertyValue(codepoint, UCHAR_INDIC_SYLLABIC_CATEGORY);
+    bool is_combining = (u_getCombiningClass(codepoint) != 0);
+    auto &codepoints = codepoints_per_kind[std::to_string(grapheme_cluster_break) + (is_pictographic ? "P" : "") + (codepoint < 0x300 ? "A" : "") + "I" + std::to_string(indic_syllabic_category) + (is_combining ? "C" : "")];
+    if (codepoints.size() < 2) {
+      codepoints.push_back(codepoint);
+    }
+  }
+  std::vector<UChar32> sample_codepoints;
+  for (const auto &kind : codepoints_per_kind) {
+    sample_codepoints.insert(sample_codepoints.end(), kind.second.begin(), kind.second.end());
+  }
+  return sample_codepoints;
+}
+
+// like the UCD's GraphemeBreakTest.txt: each kind of codepoint followed by each kind, directly or after a mark or joiner
+TEST(GraphemeCluster, SameAsIcuForPairs) {
+  UErrorCode status = U_ZERO_ERROR;
+  auto grapheme_cluster_iterator = ubrk_open(UBRK_CHARACTER, "en", nullptr, 0, &status);
+  ASSERT_TRUE(U_SUCCESS(status));
+  auto sample_codepoints = FindSampleCodepoints();
+  for (auto first : sample_codepoints) {
+    for (auto second : sample_codepoints) {
+      ExpectSameAsIcu(grapheme_cluster_iterator, {first, second});
+      ExpectSameAsIcu(grapheme_cluster_iterator, {first, 0x0308, second});
+      ExpectSameAsIcu(grapheme_cluster_iterator, {first, 0x200D, second});
+      ExpectSameAsIcu(grapheme_cluster_iterator, {first, 0x094D, second});
+    }
+  }
+  ubrk_close(grapheme_cluster_iterator);
+}
+
+TEST(GraphemeCluster, SameAsIcuForLongerSequences) {
+  UErrorCode status = U_ZERO_ERROR;
+  auto grapheme_cluster_iterator = ubrk_open(UBRK_CHARACTER, "en", nullptr, 0, &status);
+  ASSERT_TRUE(U_SUCCESS(status));
+  static const char *kTexts[] = {
+    "The quick brown fox, déjà vu (é) ä́!",
+    "line\r\nbreak\n\r\r\nend\u0085­",
+    "\U0001F468‍\U0001F469‍\U0001F467‍\U0001F466 \U0001F44D\U0001F3FD ©‍\U0001F600 a‍\U0001F600 \U0001F600̈‍\U0001F600 ‍‍\U0001F600",
+    "\U0001F1EB\U0001F1F7\U0001F1EF\U0001F1F5\U0001F1EB a\U0001F1EB\U0001F1F7\U0001F1EF",
+    "텍스트 레이아웃 한글 각 ᄀᄀ각ᆨ",
+    "संयुक्ताक्षर क्ष त्र ज्ञ क्‍ष क़्ष क्̈ष",
+    "এটি একটি পরীক্ষামূলক অনুচ্ছেদ। தமிழ் எழுத்துக்கள்",
+    "؀١ ؀ ؀\u000A",
+  };
+  for (auto text : kTexts) {
+    std::vector<UChar32> codepoints;
+    int32_t length = int32_t(std::strlen(text));
+    for (int32_t offset = 0; offset < length; ) {
+      UChar32 codepoint;
+      U8_NEXT(text, offset, length, codepoint);
+      codepoints.push_back(codepoint);
+    }
+    ExpectSameAsIcu(grapheme_cluster_iterator, codepoints);
+  }
+  ubrk_close(grapheme_cluster_iterator);
+}
+
+TEST(GraphemeCluster, RunsOfSimpleCodeUnits) {
+  UErrorCode status = U_ZERO_ERROR;
+  auto grapheme_cluster_iterator = ubrk_open(UBRK_CHARACTER, "en", nullptr, 0, &status);
+  ASSERT_TRUE(U_SUCCESS(status));
+  // runs of code units that are grapheme clusters by themselves, of different lengths around the 64 bits of a word, ended by what can attach to them
+  static const UChar32 kAfterRuns[] = { 0x0308, 0x200D, 0x0903, 0x0600, '\r', 0xA9, 0x1F600, 0xD800, 0xDC00, 0x0915 };
+  for (ssize_t run_length = 1; run_length < 140; ++run_length) {
+    for (auto after_run : kAfterRuns) {
+      std::vector<UChar32> codepoints;
+      for (ssize_t index = 0; index < run_length; ++index) {
+        static const UChar32 kSimpleCodepoints[] = { 'a', ' ', '\n', 0xA9, 0x4E00 };
+        codepoints.push_back(kSimpleCodepoints[index % 5]);
+      }
+      codepoints.push_back(after_run);
+      codepoints.push_back('b');
+      codepoints.push_back(0x1F600);
+      ExpectSameAsIcu(grapheme_cluster_iterator, codepoints);
+    }
+  }
+  ubrk_close(grapheme_cluster_iterator);
+
+  uint64_t empty_text_bits = 0;
+  glyphknit::FindGraphemeClusterBoundaries(nullptr, 0, &empty_text_bits);
+  EXPECT_EQ(1u, empty_text_bits);
+}
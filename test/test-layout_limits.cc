@@ -0,0 +1,299 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+
+#include "typesetter.hh"
+
+#include "test.h"
+
+#include <algorithm>
+#include <utility>
+
+static std::string RepeatText(const char *text, size_t count) {
+  std::string repeated;
+  for (size_t index = 0; index < count; ++index) {
+    repeated += text;
+  }
+  return repeated;
+}
+
+// the lines laid out with limits are the first ones of the lines laid out without
+static void ExpectFirstLines(glyphknit::Typesetter &typesetter, glyphknit::TextBlock &text_block, double available_width, const glyphknit::LayoutLimits &limits) {
+  auto all_lines = typesetter.PositionGlyphs(text_block, available_width);
+  bool truncated = false;
+  auto typeset_lines = typesetter.PositionGlyphs(text_block, available_width, limits, &truncated);
+  ASSERT_EQ(std::min(limits.max_lines, all_lines.size()), typeset_lines.size());
+  EXPECT_EQ(typeset_lines.size() < all_lines.size(), truncated);
+  for (size_t line_index = 0; line_index < typeset_lines.size(); ++line_index) {
+    ExpectSameLine(all_lines[line_index], typeset_lines[line_index]);
+  }
+}
+
+TEST(LayoutLimits, NoLimits) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText("The quick brown fox jumps over the lazy dog.\nPack my box with five dozen liquor jugs!");
+  bool truncated = true;
+  auto typeset_lines = typesetter.PositionGlyphs(text_block, 100, glyphknit::LayoutLimits{}, &truncated);
+  EXPECT_FALSE(truncated);
+  auto expected_lines = typesetter.PositionGlyphs(text_block, 100);
+  ASSERT_EQ(expected_lines.size(), typeset_lines.size());
+  for (size_t line_index = 0; line_index < expected_lines.size(); ++line_index) {
+    ExpectSameLine(expected_lines[line_index], typeset_lines[line_index]);
+  }
+}
+
+TEST(LayoutLimits, MaxLinesGivesTheFirstLines) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  // long paragraphs of which only the start is shaped
+  for (auto text : {"The quick brown fox jumps over the lazy dog. ", "Ça coûte 12,50 € — « déjà vu », naïve façade, ﬁnance, office. ", "مرحبا بكم في هذا الاختبار abc 123. ", "吾輩は猫である。名前はまだ無い。", "aVeryLongTokenWithoutAnySpace"}) {
+    text_block.SetText(RepeatText(text, 200).c_str());
+    for (double width : {40, 150, 400}) {
+      auto all_lines = typesetter.PositionGlyphs(text_block, width);
+      for (size_t max_lines : {1, 3, 10}) {
+        glyphknit::LayoutLimits limits;
+        limits.max_lines = max_lines;
+        bool truncated = false;
+        auto typeset_lines = typesetter.PositionGlyphs(text_block, width, limits, &truncated);
+        EXPECT_TRUE(truncated);
+        ASSERT_EQ(max_lines, typeset_lines.size());
+        for (size_t line_index = 0; line_index < max_lines; ++line_index) {
+          ExpectSameLine(all_lines[line_index], typeset_lines[line_index]);
+        }
+      }
+    }
+  }
+
+  // the direction of the paragraph comes from its first strong character, far after the start shaped
+  text_block.SetText((RepeatText("12 34, ", 300) + "שלום abc").c_str());
+  auto all_lines = typesetter.PositionGlyphs(text_block, 100);
+  glyphknit::LayoutLimits limits;
+  limits.max_lines = 2;
+  bool truncated = false;
+  auto typeset_lines = typesetter.PositionGlyphs(text_block, 100, limits, &truncated);
+  EXPECT_TRUE(truncated);
+  ASSERT_EQ(2u, typeset_lines.size());
+  for (size_t line_index = 0; line_index < 2; ++line_index) {
+    ExpectSameLine(all_lines[line_index], typeset_lines[line_index]);
+  }
+}
+
+TEST(LayoutLimits, PartOfAParagraphWithAttributes) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 12};
+  text_block.SetText(RepeatText("The quick brown fox jumps over the lazy dog. ", 40).c_str());
+  // the bigger text starts in the part of the paragraph shaped first and ends after it
+  text_block.SetFontSize(20, 100, 1500);
+  text_block.SetFontFace(glyphknit::FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSerif.ttf"), 1400, 1600);
+  for (double width : {100, 300}) {
+    for (size_t max_lines : {1, 3, 10, 30}) {
+      glyphknit::LayoutLimits limits;
+      limits.max_lines = max_lines;
+      ExpectFirstLines(typesetter, text_block, width, limits);
+    }
+    ExpectFirstLines(typesetter, text_block, width, glyphknit::LayoutLimits{});
+  }
+}
+
+TEST(LayoutLimits, PartOfAParagraphInMixedDirections) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  // the space after the right-to-left text is right-to-left because of the number after the line separator, which might not be in the part of the paragraph shaped
+  // (the combining marks making lines hold more characters than estimated, so that the paragraph is shaped several times)
+  for (size_t words_before : {0, 16, 18}) {
+    text_block.SetText((RepeatText("a\u0300\u0300\u0300\u0300 ", words_before) + "שלום \u2028" + RepeatText("123 ", 200)).c_str());
+    for (double width : {40, 100}) {
+      for (size_t max_lines = 1; max_lines <= 12; ++max_lines) {
+        glyphknit::LayoutLimits limits;
+        limits.max_lines = max_lines;
+        ExpectFirstLines(typesetter, text_block, width, limits);
+      }
+      ExpectFirstLines(typesetter, text_block, width, glyphknit::LayoutLimits{});
+    }
+  }
+
+  // a part all right-to-left of a paragraph that is not has its runs in the same order: the last one logically on the left
+  text_block.SetText("שלום مرحبا");
+  auto typeset_lines = typesetter.PositionGlyphs(text_block, 1000);
+  ASSERT_EQ(1u, typeset_lines.size());
+  EXPECT_EQ(9, typeset_lines[0].runs.front().glyphs.front().offset);
+}
+
+TEST(LayoutLimits, OnlyShapesWhatIsNeeded) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText(RepeatText("The quick brown fox jumps over the lazy dog. ", 1000).c_str());
+  glyphknit::LayoutLimits limits;
+  limits.max_lines = 3;
+  glyphknit::TypesetStats stats;
+  typesetter.set_stats(&stats);
+  bool truncated = false;
+  typesetter.PositionGlyphs(text_block, 400, limits, &truncated);
+  EXPECT_TRUE(truncated);
+  auto limited_nanoseconds = stats.phase_nanoseconds[glyphknit::TypesetStats::kShape];
+  stats.Reset();
+  typesetter.PositionGlyphs(text_block, 400);
+  EXPECT_LT(limited_nanoseconds * 10, stats.phase_nanoseconds[glyphknit::TypesetStats::kShape]);
+}
+
+TEST(LayoutLimits, MaxLinesAcrossParagraphs) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText("a\nb\nc\n");
+  glyphknit::LayoutLimits limits;
+  bool truncated = false;
+  limits.max_lines = 3;
+  EXPECT_EQ(3u, typesetter.PositionGlyphs(text_block, 100, limits, &truncated).size());
+  EXPECT_FALSE(truncated);
+  limits.max_lines = 2;
+  EXPECT_EQ(2u, typesetter.PositionGlyphs(text_block, 100, limits, &truncated).size());
+  EXPECT_TRUE(truncated);
+}
+
+TEST(LayoutLimits, MaxHeight) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText(RepeatText("The quick brown fox jumps over the lazy dog. ", 100).c_str());
+  auto all_lines = typesetter.PositionGlyphs(text_block, 200);
+  auto line_height = all_lines.front().height();
+
+  glyphknit::LayoutLimits limits;
+  bool truncated = false;
+  limits.max_height = 4 * line_height + 1;
+  EXPECT_EQ(4u, typesetter.PositionGlyphs(text_block, 200, limits, &truncated).size());
+  EXPECT_TRUE(truncated);
+  limits.max_height = line_height - 1;
+  EXPECT_EQ(0u, typesetter.PositionGlyphs(text_block, 200, limits, &truncated).size());
+  EXPECT_TRUE(truncated);
+  limits.max_height = all_lines.size() * line_height;
+  EXPECT_EQ(all_lines.size(), typesetter.PositionGlyphs(text_block, 200, limits, &truncated).size());
+  EXPECT_FALSE(truncated);
+}
+
+TEST(LayoutLimits, Ellipsis) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText("The quick brown fox jumps over the lazy dog.");
+  auto all_lines = typesetter.PositionGlyphs(text_block, 100);
+  ASSERT_LT(2u, all_lines.size());
+
+  glyphknit::LayoutLimits limits;
+  limits.max_lines = 2;
+  limits.ellipsis = true;
+  bool truncated = false;
+  auto typeset_lines = typesetter.PositionGlyphs(text_block, 100, limits, &truncated);
+  EXPECT_TRUE(truncated);
+  ASSERT_EQ(2u, typeset_lines.size());
+  ExpectSameLine(all_lines[0], typeset_lines[0]);
+  const auto &last_line = typeset_lines[1];
+  EXPECT_LE(LineWidth(last_line), 100);
+  const auto &ellipsis_run = last_line.runs.back();
+  ASSERT_EQ(1u, ellipsis_run.glyphs.size());
+  hb_codepoint_t ellipsis_glyph;
+  ASSERT_TRUE(hb_font_get_glyph(LoadTestFont().GetHBFont(), 0x2026, 0, &ellipsis_glyph));
+  EXPECT_EQ(ellipsis_glyph, ellipsis_run.glyphs.front().id);
+  // cut at a grapheme cluster boundary, without the space before the ellipsis
+  auto ellipsis_offset = ellipsis_run.glyphs.front().offset;
+  EXPECT_LT(0, ellipsis_offset);
+  EXPECT_NE(' ', text_block.text_content()[ellipsis_offset - 1]);
+
+  // a line too narrow for anything else than the ellipsis
+  text_block.SetText("abcdef ghijkl");
+  typeset_lines = typesetter.PositionGlyphs(text_block, 1, limits, &truncated);
+  EXPECT_TRUE(truncated);
+  ASSERT_EQ(2u, typeset_lines.size());
+  ASSERT_EQ(1u, typeset_lines[1].runs.size());
+  EXPECT_EQ(1, typeset_lines[1].runs.front().glyphs.front().offset);
+
+  // no ellipsis when everything fits
+  limits.max_lines = 10;
+  typeset_lines = typesetter.PositionGlyphs(text_block, 1000, limits, &truncated);
+  EXPECT_FALSE(truncated);
+  ASSERT_EQ(1u, typeset_lines.size());
+  EXPECT_EQ(text_block.text_length() - 1, typeset_lines[0].runs.back().glyphs.back().offset);
+}
+
+TEST(LayoutLimits, EllipsisAtTheEndOfAParagraph) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText("abc\ndef");
+  glyphknit::LayoutLimits limits;
+  limits.max_lines = 1;
+  limits.ellipsis = true;
+  bool truncated = false;
+  auto typeset_lines = typesetter.PositionGlyphs(text_block, 1000, limits, &truncated);
+  EXPECT_TRUE(truncated);
+  ASSERT_EQ(1u, typeset_lines.size());
+  ASSERT_EQ(2u, typeset_lines[0].runs.size());
+  EXPECT_EQ(3, typeset_lines[0].runs.back().glyphs.front().offset);
+}
+
+TEST(LayoutLimits, EllipsisInMixedDirectionText) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  hb_codepoint_t ellipsis_glyph;
+  ASSERT_TRUE(hb_font_get_glyph(LoadTestFont().GetHBFont(), 0x2026, 0, &ellipsis_glyph));
+  glyphknit::LayoutLimits limits;
+  limits.max_lines = 1;
+  limits.ellipsis = true;
+  // the line is cut in right-to-left text in a left-to-right paragraph, then the opposite
+  for (auto text : {"abc " + RepeatText("שלום ", 20), "שלום " + RepeatText("abc ", 30)}) {
+    text_block.SetText(text.c_str());
+    bool truncated = false;
+    auto typeset_lines = typesetter.PositionGlyphs(text_block, 150, limits, &truncated);
+    EXPECT_TRUE(truncated);
+    ASSERT_EQ(1u, typeset_lines.size());
+    const auto &runs = typeset_lines[0].runs;
+    ASSERT_LT(2u, runs.size());
+
+    auto ellipsis_run = std::find_if(runs.begin(), runs.end(), [&](const auto &run) {
+      return run.glyphs.front().id == ellipsis_glyph;
+    });
+    ASSERT_NE(runs.end(), ellipsis_run);
+    // next to the end of the text it follows: after it in left-to-right text, before it in right-to-left text
+    glyphknit::TextOffset end_offset = -1;
+    auto end_run = runs.end();
+    for (auto run = runs.begin(); run != runs.end(); ++run) {
+      for (const auto &glyph : run->glyphs) {
+        if (run != ellipsis_run && glyph.offset > end_offset) {
+          end_offset = glyph.offset;
+          end_run = run;
+        }
+      }
+    }
+    ASSERT_NE(runs.end(), end_run);
+    EXPECT_NE(runs.begin(), ellipsis_run);
+    EXPECT_NE(runs.end() - 1, ellipsis_run);
+    if (end_run->bidi_direction == UBIDI_RTL) {
+      EXPECT_EQ(end_run - 1, ellipsis_run);
+    }
+    else {
+      EXPECT_EQ(end_run + 1, ellipsis_run);
+    }
+    EXPECT_TRUE(std::is_sorted(runs.begin(), runs.end(), [](const auto &run_a, const auto &run_b) {
+      return std::make_pair(run_a.bidi_visual_index, run_a.bidi_visual_subindex) < std::make_pair(run_b.bidi_visual_index, run_b.bidi_visual_subindex);
+    }));
+  }
+}
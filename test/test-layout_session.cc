@@ -0,0 +1,259 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "layout_session.hh"
+
+#include "test.h"
+
+TEST(LayoutSession, Edits) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText("The quick brown fox jumps over the lazy dog.\nabc\r\ndef\n\nghi");
+  glyphknit::LayoutSession session{typesetter, text_block};
+
+  auto changed_lines = session.Update(100);
+  EXPECT_EQ(5u, session.paragraphs().size());
+  EXPECT_EQ(0u, changed_lines.start_line_index);
+  EXPECT_EQ(0u, changed_lines.old_lines_count);
+  EXPECT_EQ(session.lines_count(), changed_lines.new_lines_count);
+  ExpectSameGlyphs(typesetter.PositionGlyphs(text_block, 100), session.AllLines());
+
+  struct Edit {
+    ssize_t start, end;
+    const char *text;
+    size_t paragraphs_count;
+  };
+  const Edit edits[] = {
+    {46, 47, "x", 5},  // "abc" -> "axc"
+    {47, 48, "\r", 6},  // "axc\r\n" -> "ax\r\r\n", splitting the paragraph
+    {48, 49, "", 5},  // "ax\r\r\n" -> "ax\r\n", the CR before the change becoming part of a CR+LF
+    {0, 0, "Oh, ", 5},  // moving all the following paragraphs
+    {48, 49, "", 4},  // joining the first two paragraphs
+    {48, 48, "\n\n", 6},
+    {58, 62, "", 4},  // removing the last paragraph
+    {0, 0, "\xE2\x80\xA9", 5},  // paragraph separator at the start of the text
+    {0, 59, "", 0},
+    {0, 0, "a", 1},
+  };
+  for (const auto &edit : edits) {
+    text_block.ReplaceText(edit.start, edit.end, edit.text);
+    session.Update(100);
+    EXPECT_EQ(edit.paragraphs_count, session.paragraphs().size());
+    auto expected = typesetter.PositionGlyphs(text_block, 100);
+    EXPECT_EQ(expected.size(), session.lines_count());
+    ExpectSameGlyphs(expected, session.AllLines());
+  }
+}
+
+TEST(LayoutSession, OnlyChangedParagraphs) {
+  glyphknit::TypesetStats stats;
+  glyphknit::Typesetter typesetter;
+  typesetter.set_stats(&stats);
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText("aaa bbb\nccc ddd\neee fff");
+  glyphknit::LayoutSession session{typesetter, text_block};
+  session.Update(1000);
+  EXPECT_EQ(3u, session.lines_count());
+
+  // the second paragraph gets longer than a line
+  stats.Reset();
+  text_block.ReplaceText(9, 9, " xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx");
+  auto changed_lines = session.Update(200);
+  EXPECT_EQ(0u, changed_lines.start_line_index);  // changing the width lays out everything again
+  EXPECT_EQ(3u, changed_lines.old_lines_count);
+  auto second_paragraph_lines_count = session.paragraphs()[1].typeset_lines.size();
+  EXPECT_LT(1u, second_paragraph_lines_count);
+  EXPECT_EQ(2 + second_paragraph_lines_count, changed_lines.new_lines_count);
+  EXPECT_EQ(1, stats.shape_calls_count);  // but only the changed paragraph is shaped again
+  ExpectSameGlyphs(typesetter.PositionGlyphs(text_block, 200), session.AllLines());
+
+  stats.Reset();
+  text_block.ReplaceText(9, 42, "");
+  changed_lines = session.Update(200);
+  EXPECT_EQ(1u, changed_lines.start_line_index);
+  EXPECT_EQ(second_paragraph_lines_count, changed_lines.old_lines_count);
+  EXPECT_EQ(1u, changed_lines.new_lines_count);
+  EXPECT_EQ(1, stats.shape_calls_count);
+
+  // at the start of a paragraph the previous one is also shaped again
+  // (as the change could have made its separator part of the changed paragraph), but its lines do not change
+  stats.Reset();
+  text_block.ReplaceText(16, 16, "e");
+  changed_lines = session.Update(200);
+  EXPECT_EQ(2u, changed_lines.start_line_index);
+  EXPECT_EQ(1u, changed_lines.old_lines_count);
+  EXPECT_EQ(1u, changed_lines.new_lines_count);
+  EXPECT_EQ(2, stats.shape_calls_count);
+
+  // a change of attributes
+  stats.Reset();
+  text_block.SetFontSize(20, 1, 2);
+  changed_lines = session.Update(200);
+  EXPECT_EQ(0u, changed_lines.start_line_index);
+  EXPECT_EQ(1u, changed_lines.old_lines_count);
+  EXPECT_EQ(1u, changed_lines.new_lines_count);
+  ExpectSameGlyphs(typesetter.PositionGlyphs(text_block, 200), session.AllLines());
+
+  // nothing changed
+  stats.Reset();
+  changed_lines = session.Update(200);
+  EXPECT_EQ(0u, changed_lines.old_lines_count);
+  EXPECT_EQ(0u, changed_lines.new_lines_count);
+  EXPECT_EQ(0, stats.shape_calls_count);
+}
+
+TEST(LayoutSession, ReflowInParagraph) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText("Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. "
+                     "Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea commodo consequat office.\nabc");
+  glyphknit::LayoutSession session{typesetter, text_block};
+  session.Update(150);
+  auto lines_count = session.lines_count();
+  ASSERT_LT(10u, lines_count);
+
+  // a word getting longer near the end of the paragraph only changes the lines around it
+  text_block.ReplaceText(222, 222, "xxxx");
+  auto changed_lines = session.Update(150);
+  EXPECT_LE(lines_count - 5, changed_lines.start_line_index);
+  EXPECT_GE(3u, changed_lines.old_lines_count);
+  ExpectSameGlyphs(typesetter.PositionGlyphs(text_block, 150), session.AllLines());
+
+  // removing it makes the start of the line fit on the previous one
+  text_block.ReplaceText(222, 226, "");
+  session.Update(150);
+  ExpectSameGlyphs(typesetter.PositionGlyphs(text_block, 150), session.AllLines());
+
+  struct Edit {
+    ssize_t start, end;
+    const char *text;
+  };
+  const Edit edits[] = {
+    {0, 0, "A"},  // everything moves
+    {6, 7, ""},  // the first word grows
+    {40, 50, ""},
+    {100, 100, " "},
+    {100, 100, "\xE2\x80\xA8"},  // line separator
+    {100, 101, ""},
+    {50, 50, "\xD7\xA9\xD7\x9C\xD7\x95\xD7\x9D \xD7\xA2\xD7\x95\xD7\x9C\xD7\x9D"},  // right-to-left text
+    {233, 234, ""},  // "office" -> "ofice", changing the ligature
+    {237, 238, ""},  // joining with the next paragraph
+  };
+  for (const auto &edit : edits) {
+    text_block.ReplaceText(edit.start, edit.end, edit.text);
+    changed_lines = session.Update(150);
+    auto expected = typesetter.PositionGlyphs(text_block, 150);
+    EXPECT_EQ(expected.size(), session.lines_count());
+    EXPECT_EQ(expected.size(), lines_count + changed_lines.new_lines_count - changed_lines.old_lines_count);
+    ExpectSameGlyphs(expected, session.AllLines());
+    lines_count = session.lines_count();
+  }
+}
+
+TEST(LayoutSession, ReflowInsideLigatures) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  // a word too wide for the lines, cut inside its fi and ffi ligatures
+  const char *text = "supercalifragilisticexpialidociousfisupercalifragilisticexpialidociousffisupercalifragilisticexpialidocious "
+                     "officefinefluffiest office affine suffice";
+  struct Edit {
+    ssize_t start, end;
+    const char *text;
+  };
+  const Edit edits[] = {
+    {6, 6, "office "},
+    {40, 41, ""},
+    {60, 60, "office "},
+    {0, 1, ""},
+    {90, 90, "fi"},
+    {120, 125, ""},
+  };
+  for (double width : {20, 37, 78}) {
+    text_block.SetText(text);
+    glyphknit::LayoutSession session{typesetter, text_block};
+    session.Update(width);
+    ExpectSameGlyphs(typesetter.PositionGlyphs(text_block, width), session.AllLines());
+    for (const auto &edit : edits) {
+      text_block.ReplaceText(edit.start, edit.end, edit.text);
+      session.Update(width);
+      auto expected = typesetter.PositionGlyphs(text_block, width);
+      EXPECT_EQ(expected.size(), session.lines_count());
+      ExpectSameGlyphs(expected, session.AllLines());
+    }
+  }
+}
+
+TEST(LayoutSession, ReplaceTextAttributes) {
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText("abcdef");
+  text_block.SetFontSize(20, 2, 4);
+  text_block.ClearChanges();
+
+  // the inserted text gets the attributes of the character before it
+  text_block.ReplaceText(4, 4, "xy");
+  ASSERT_EQ(3u, text_block.attributes_runs().size());
+  EXPECT_EQ(2, std::next(text_block.attributes_runs().begin())->start);
+  EXPECT_EQ(6, std::next(text_block.attributes_runs().begin())->end);
+  // removing a whole run
+  text_block.ReplaceText(1, 7, "z");
+  ASSERT_EQ(1u, text_block.attributes_runs().size());
+  EXPECT_EQ(3, text_block.attributes_runs().front().end);
+
+  ASSERT_EQ(2u, text_block.changes().size());
+  auto change = text_block.changes()[0].FollowedBy(text_block.changes()[1]);
+  EXPECT_EQ(1, change.start);
+  EXPECT_EQ(5, change.old_end);
+  EXPECT_EQ(2, change.new_end);
+}
+
+TEST(LayoutSession, LineBreakingOfTheTypesetter) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::ShapedParagraph::OptimalLineBreakingParameters parameters;
+  typesetter.set_optimal_line_breaking(&parameters);
+  glyphknit::TextBlock text_block{glyphknit::FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSansMono.ttf"), 10};
+  text_block.SetText("aaa bb cc ddddd\nabc def");
+  glyphknit::LayoutSession session{typesetter, text_block};
+  session.Update(40);
+  auto typeset_lines = session.AllLines();
+  EXPECT_EQ(4u, typeset_lines[0].runs[0].glyphs.size());  // "aaa ", the greedy line breaking giving "aaa bb "
+  ExpectSameGlyphs(typesetter.PositionGlyphs(text_block, 40), typeset_lines);
+
+  // the whole paragraph is broken again after an edit
+  text_block.ReplaceText(1, 1, "a");
+  session.Update(40);
+  ExpectSameGlyphs(typesetter.PositionGlyphs(text_block, 40), session.AllLines());
+  typesetter.set_balanced_line_breaking(true);
+  session.Update(30);
+  ExpectSameGlyphs(typesetter.PositionGlyphs(text_block, 30), session.AllLines());
+
+  // and when only the line breaking changes
+  typesetter.set_balanced_line_breaking(false);
+  session.Update(46);
+  EXPECT_EQ(5u, session.AllLines()[0].runs[0].glyphs.size());  // "aaaa "
+  typesetter.set_optimal_line_breaking(nullptr);
+  session.Update(46);
+  typeset_lines = session.AllLines();
+  EXPECT_EQ(8u, typeset_lines[0].runs[0].glyphs.size());  // "aaaa bb "
+  ExpectSameGlyphs(typesetter.PositionGlyphs(text_block, 46), typeset_lines);
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "line_break.hh"
+
+#include "test.h"
+
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+#include <unicode/ubrk.h>
+#include <unicode/uchar.h>
+#include <unicode/ustring.h>
+
+static std::vector<uint16_t> ConvertToUTF16(const std::vector<UChar32> &codepoints) {
+  std::vector<uint16_t> text;
+  for (auto codepoint : codepoints) {
+    if (codepoint > 0xFFFF) {
+      text.push_back(U16_LEAD(codepoint));
+      text.push_back(U16_TRAIL(codepoint));
+    }
+    else {
+      text.push_back(uint16_t(codepoint));
+    }
+  }
+  return text;
+}
+
+static std::vector<uint64_t> FindWithIcu(UBreakIterator *line_break_iterator, const std::vector<uint16_t> &text) {
+  std::vector<uint64_t> bits(text.size() / 64 + 1);
+  UErrorCode status = U_ZERO_ERROR;
+  ubrk_setText(line_break_iterator, text.data(), int32_t(text.size()), &status);
+  EXPECT_TRUE(U_SUCCESS(status));
+  for (auto line_break = ubrk_first(line_break_iterator); line_break != UBRK_DONE; line_break = ubrk_next(line_break_iterator)) {
+    bits[size_t(line_break) / 64] |= uint64_t(1) << (size_t(line_break) % 64);
+  }
+  return bits;
+}
+
+static std::string Describe(const std::vector<UChar32> &codepoints) {
+  std::string description;
+  for (auto codepoint : codepoints) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%04X(%s) ", codepoint, u_getPropertyValueName(UCHAR_LINE_BREAK, u_getIntPropertyValue(codepoint, UCHAR_LINE_BREAK), U_SHORT_PROPERTY_NAME));
+    description += buffer;
+  }
+  return description;
+}
+
+static void ExpectSameAsIcu(UBreakIterator *line_break_iterator, const std::vector<UChar32> &codepoints) {
+  auto text = ConvertToUTF16(codepoints);
+  std::vector<uint64_t> bits(text.size() / 64 + 1);
+  ASSERT_TRUE(glyphknit::FindLineBreakOpportunities(text.data(), ssize_t(text.size()), bits.data())) << Describe(codepoints);
+  EXPECT_EQ(FindWithIcu(line_break_iterator, text), bits) << Describe(codepoints);
+}
+
+// a few codepoints of each line break class, also separating the ones only concerned by some of the rules
+static std::vector<UChar32> FindSampleCodepoints() {
+  std::map<std::string, std::vector<UChar32>> codepoints_per_kind;
+  for (UChar32 codepoint = 0; codepoint <= 0x10FFFF; ++codepoint) {
+    auto line_break = u_getIntPropertyValue(codepoint, UCHAR_LINE_BREAK);
+    if (line_break == U_LB_COMPLEX_CONTEXT || line_break == U_LB_SURROGATE) {
+      continue;
+    }
+    auto east_asian_width = u_getIntPropertyValue(codepoint, UCHAR_EAST_ASIAN_WIDTH);
+    bool is_wide = (east_asian_width == U_EA_FULLWIDTH || east_asian_width == U_EA_WIDE || east_asian_width == U_EA_HALFWIDTH);
+    bool is_unassigned_pictographic = (u_hasBinaryProperty(codepoint, UCHAR_EXTENDED_PICTOGRAPHIC) && u_charType(codepoint) == U_UNASSIGNED);
+    auto &codepoints = codepoints_per_kind[std::to_string(line_break) + (is_wide ? "W" : "") + (is_unassigned_pictographic ? "P" : "")];
+    if (codepoints.size() < 2) {
+      codepoints.push_back(codepoint);
+    }
+  }
+  std::vector<UChar32> sample_codepoints;
+  for (const auto &kind : codepoints_per_kind) {
+    sample_codepoints.insert(sample_codepoints.end(), kind.second.begin(), kind.second.end());
+  }
+  return sample_codepoints;
+}
+
+// the same pairs as the UCD's LineBreakTest.txt: each class followed by each class, directly or after a space or combining mark
+TEST(LineBreak, SameAsIcuForPairs) {
+  UErrorCode status = U_ZERO_ERROR;
+  auto line_break_iterator = ubrk_open(UBRK_LINE, "en", nullptr, 0, &status);
+  ASSERT_TRUE(U_SUCCESS(status));
+  auto sample_codepoints = FindSampleCodepoints();
+  for (auto first : sample_codepoints) {
+    for (auto second : sample_codepoints) {
+      ExpectSameAsIcu(line_break_iterator, {first, second});
+      ExpectSameAsIcu(line_break_iterator, {first, 0x20, second});
+      ExpectSameAsIcu(line_break_iterator, {first, 0x0301, second});
+      ExpectSameAsIcu(line_break_iterator, {first, 0x0301, 0x20, second});
+      ExpectSameAsIcu(line_break_iterator, {first, 0x200D, second});
+    }
+  }
+  ubrk_close(line_break_iterator);
+}
+
+TEST(LineBreak, SameAsIcuForLongerSequences) {
+  UErrorCode status = U_ZERO_ERROR;
+  auto line_break_iterator = ubrk_open(UBRK_LINE, "en", nullptr, 0, &status);
+  ASSERT_TRUE(U_SUCCESS(status));
+  static const char *kTexts[] = {
+    "The quick (\"brown\") fox can’t jump 32.3 feet, right?",
+    "$(12.35) 2,1234 (12)¢ 12.54¢ -3.5 x -y 1/2 .5 -.5 a .5 a  ,5",
+    "http://www.example.com/path/to?query=1&b=2#anchor",
+    "בְּרֵאשִׁית-בָּרָא - hebrew-letters",
+    "\U0001F1EB\U0001F1F7\U0001F1EF\U0001F1F5\U0001F1EB \U0001F468‍\U0001F469‍\U0001F467 ☝\U0001F3FB\U0001F3FB",
+    "吾輩は猫である。名前はまだ無い。「どこで」生れたかとんと見当がつかぬ。",
+    "텍스트 레이아웃 엔진은 여러 문자 체계를 처리해야 합니다.",
+    "a​  b⁠c d——e — —f",
+    "line\r\nbreak\nand separators\u000B\u000C\u0085end",
+  };
+  for (auto text : kTexts) {
+    std::vector<UChar32> codepoints;
+    int32_t length = int32_t(std::strlen(text));
+    for (int32_t offset = 0; offset < length; ) {
+      UChar32 codepoint;
+      U8_NEXT(text, offset, length, codepoint);
+      codepoints.push_back(codepoint);
+    }
+    ExpectSameAsIcu(line_break_iterator, codepoints);
+  }
+  ubrk_close(line_break_iterator);
+}
+
+TEST(LineBreak, Dictionary) {
+  // Thai needs a dictionary
+  const uint16_t text[] = {'a', ' ', 0x0E20, 0x0E32, 0x0E29, 0x0E32};
+  uint64_t bits = 0;
+  EXPECT_FALSE(glyphknit::FindLineBreakOpportunities(text, 6, &bits));
+
+  uint64_t empty_text_bits = 0;
+  EXPECT_TRUE(glyphknit::FindLineBreakOpportunities(text, 0, &empty_text_bits));
+  EXPECT_EQ(1u, empty_text_bits);
+}
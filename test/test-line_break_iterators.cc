@@ -0,0 +1,65 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "line_break_iterators.hh"
+
+#include "test.h"
+
+#include <unicode/ustring.h>
+
+TEST(LineBreakIterators, IsTailored) {
+  glyphknit::LineBreakIterators line_break_iterators;
+  EXPECT_TRUE(line_break_iterators.IsTailored(glyphknit::FindLanguageCodeAndOpenTypeLanguageTag("ja")));
+  EXPECT_FALSE(line_break_iterators.IsTailored(glyphknit::FindLanguageCodeAndOpenTypeLanguageTag("en")));
+  EXPECT_FALSE(line_break_iterators.IsTailored(glyphknit::FindLanguageCodeAndOpenTypeLanguageTag("fr")));
+  EXPECT_FALSE(line_break_iterators.IsTailored(glyphknit::FindLanguageCodeAndOpenTypeLanguageTag("th")));
+  EXPECT_FALSE(line_break_iterators.IsTailored(glyphknit::kLanguageUnknown));
+}
+
+TEST(LineBreakIterators, Get) {
+  auto japanese = glyphknit::FindLanguageCodeAndOpenTypeLanguageTag("ja");
+  glyphknit::LineBreakIterators line_break_iterators;
+  auto japanese_iterator = line_break_iterators.Get(japanese);
+  ASSERT_NE(nullptr, japanese_iterator);
+  EXPECT_EQ(japanese_iterator, line_break_iterators.Get(japanese));
+  EXPECT_NE(japanese_iterator, line_break_iterators.Get(glyphknit::kLanguageUnknown));
+
+  // each one has its own clones, with the rules of the language
+  glyphknit::LineBreakIterators other_line_break_iterators;
+  auto other_japanese_iterator = other_line_break_iterators.Get(japanese);
+  EXPECT_NE(japanese_iterator, other_japanese_iterator);
+  UChar text[16];
+  int32_t length;
+  UErrorCode status = U_ZERO_ERROR;
+  u_strFromUTF8(text, 16, &length, "ニャー", -1, &status);
+  ubrk_setText(japanese_iterator, text, length, &status);
+  ubrk_setText(other_japanese_iterator, text, length, &status);
+  ASSERT_TRUE(U_SUCCESS(status));
+  EXPECT_TRUE(ubrk_isBoundary(japanese_iterator, 1));  // Japanese allows breaks before small kana
+  EXPECT_TRUE(ubrk_isBoundary(other_japanese_iterator, 2));
+  auto default_iterator = line_break_iterators.Get(glyphknit::kLanguageUnknown);
+  ubrk_setText(default_iterator, text, length, &status);
+  ASSERT_TRUE(U_SUCCESS(status));
+  EXPECT_FALSE(ubrk_isBoundary(default_iterator, 1));
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+
+#include "typesetter.hh"
+
+#include "test.h"
+
+#include <cstdlib>
+#include <new>
+
+// the allocations done through operator new are counted while enabled
+// (not the ones of the C libraries like ICU or HarfBuzz, that use malloc directly)
+static bool counting_allocations = false;
+static size_t allocations_count = 0;
+
+void *operator new(size_t size) {
+  if (counting_allocations) {
+    ++allocations_count;
+  }
+  void *memory = std::malloc(size == 0 ? 1 : size);
+  if (memory == nullptr) {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+void operator delete(void *memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept {
+  std::free(memory);
+}
+
+TEST(Measure, SameLinesAsPositionGlyphs) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText("The quick brown fox jumps over the lazy dog.\nשלום עולם 123\n\n吾輩は猫である。名前はまだ無い。");
+  text_block.SetFontSize(20, 4, 9);
+
+  for (double width : {30, 100, 200, 1000}) {
+    auto typeset_lines = typesetter.PositionGlyphs(text_block, width);
+    auto metrics = typesetter.Measure(text_block, width);
+    ASSERT_EQ(typeset_lines.size(), metrics.lines_count());
+    glyphknit::Coordinate height = 0;
+    glyphknit::Coordinate widest_line_width = 0;
+    for (size_t line_index = 0; line_index < typeset_lines.size(); ++line_index) {
+      const auto &line_metrics = metrics.lines[line_index];
+      EXPECT_EQ(typeset_lines[line_index].ascent, line_metrics.ascent);
+      EXPECT_EQ(typeset_lines[line_index].descent, line_metrics.descent);
+      EXPECT_EQ(typeset_lines[line_index].leading, line_metrics.leading);
+      height += line_metrics.height();
+      widest_line_width = std::max(widest_line_width, line_metrics.width);
+      EXPECT_LE(0, line_metrics.width);
+    }
+    EXPECT_DOUBLE_EQ(height, metrics.height);
+    EXPECT_DOUBLE_EQ(widest_line_width, metrics.width);
+  }
+  // the line with the bigger font is higher
+  auto metrics = typesetter.Measure(text_block, 1000);
+  EXPECT_LT(metrics.lines[1].height(), metrics.lines[0].height());
+}
+
+TEST(Measure, WidthWithoutWhitespaceAtTheEnd) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText("abc def");
+  auto one_word_metrics = typesetter.Measure(text_block, 1000);
+  ASSERT_EQ(1u, one_word_metrics.lines_count());
+
+  auto metrics = typesetter.Measure(text_block, one_word_metrics.width - 1);
+  ASSERT_EQ(2u, metrics.lines_count());
+  text_block.SetText("abc");
+  EXPECT_DOUBLE_EQ(typesetter.Measure(text_block, 1000).width, metrics.lines[0].width);
+
+  text_block.SetText("");
+  metrics = typesetter.Measure(text_block, 1000);
+  EXPECT_EQ(0u, metrics.lines_count());
+  EXPECT_EQ(0, metrics.height);
+}
+
+TEST(Measure, ReusesMemory) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText("The quick brown fox jumps over the lazy dog.\nPack my box with five dozen liquor jugs!");
+  glyphknit::TextMetrics metrics;
+  typesetter.Measure(text_block, 100, &metrics);
+  auto lines_count = metrics.lines_count();
+  const auto *lines_data = metrics.lines.data();
+  typesetter.Measure(text_block, 100, &metrics);
+  EXPECT_EQ(lines_count, metrics.lines_count());
+  EXPECT_EQ(lines_data, metrics.lines.data());
+
+  // nothing is allocated once the runs, glyphs and lines of the paragraphs fit in the memory already used
+  text_block.SetText("The quick brown fox jumps over the lazy dog.\nשלום עולם 123 abc\n\n吾輩は猫 ﬃ ffiffiffiffiffiffiffiffi");
+  text_block.SetFontSize(20, 4, 9);
+  typesetter.Measure(text_block, 100, &metrics);
+  allocations_count = 0;
+  counting_allocations = true;
+  typesetter.Measure(text_block, 100, &metrics);
+  counting_allocations = false;
+  EXPECT_EQ(0u, allocations_count);
+}
+
+TEST(Measure, IntrinsicWidths) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText("defgh");
+  auto longest_word_width = typesetter.Measure(text_block, 1000).width;
+  text_block.SetText("abc de");
+  auto longest_line_width = typesetter.Measure(text_block, 1000).width;
+
+  text_block.SetText("abc defgh ij \nabc de f");
+  auto widths = typesetter.MeasureIntrinsicWidths(text_block);
+  EXPECT_DOUBLE_EQ(longest_word_width, widths.min_content);
+  EXPECT_DOUBLE_EQ(typesetter.Measure(text_block, 1000).width, widths.max_content);
+  EXPECT_LT(longest_line_width, widths.max_content);
+
+  // at these widths, the lines are only broken at line break opportunities, or only at paragraph and line separators
+  for (size_t paragraph_start_index : {0, 14}) {
+    auto paragraph = typesetter.ShapeParagraph(text_block, paragraph_start_index, paragraph_start_index == 0 ? 13 : text_block.text_length());
+    for (const auto &line : paragraph.BreakLines(widths.min_content)) {
+      EXPECT_FALSE(line.emergency_break);
+    }
+  }
+  EXPECT_EQ(3u, typesetter.Measure(text_block, widths.max_content).lines_count());
+  EXPECT_LT(3u, typesetter.Measure(text_block, widths.max_content - 0.5).lines_count());
+
+  text_block.SetText("");
+  widths = typesetter.MeasureIntrinsicWidths(text_block);
+  EXPECT_EQ(0, widths.min_content);
+  EXPECT_EQ(0, widths.max_content);
+}
+
+TEST(Measure, IntrinsicWidthsWithFontFallback) {
+  glyphknit::Typesetter typesetter;
+  // DejaVu Sans does not have glyphs for kanji, and they must get the same fallback font as when laying out lines
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText("吾輩は猫である");
+  auto widths = typesetter.MeasureIntrinsicWidths(text_block);
+  EXPECT_DOUBLE_EQ(typesetter.Measure(text_block, 1000).width, widths.max_content);
+  EXPECT_EQ(1u, typesetter.Measure(text_block, widths.max_content).lines_count());
+  EXPECT_LT(0, widths.min_content);
+  EXPECT_LT(widths.min_content, widths.max_content);
+}
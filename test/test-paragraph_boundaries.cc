@@ -0,0 +1,147 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "paragraph_boundaries.hh"
+#include "utf.hh"
+
+#include "test.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include <unicode/uchar.h>
+#include <unicode/ustring.h>
+
+static std::vector<uint16_t> ConvertToUTF16(const char *utf8_text) {
+  std::vector<uint16_t> text(std::strlen(utf8_text));
+  int32_t length;
+  UErrorCode status = U_ZERO_ERROR;
+  u_strFromUTF8(text.data(), int32_t(text.size()), &length, utf8_text, -1, &status);
+  EXPECT_TRUE(U_SUCCESS(status));
+  text.resize(size_t(length));
+  return text;
+}
+
+// compares the bitmaps with asking ICU about each index
+static void ExpectSameAsIcu(const char *utf8_text) {
+  auto text = ConvertToUTF16(utf8_text);
+  auto length = ssize_t(text.size());
+  UErrorCode status = U_ZERO_ERROR;
+  auto line_break_iterator = ubrk_open(UBRK_LINE, "en", nullptr, 0, &status);
+  auto grapheme_cluster_iterator = ubrk_open(UBRK_CHARACTER, "en", nullptr, 0, &status);
+  ASSERT_TRUE(U_SUCCESS(status));
+
+  glyphknit::ParagraphBoundaries boundaries;
+  if (!boundaries.Find(text.data(), length)) {
+    boundaries.FindLineBreakOpportunitiesWithIterator(text.data(), 0, length, line_break_iterator);
+  }
+  EXPECT_EQ(length, boundaries.length());
+  ubrk_setText(line_break_iterator, text.data(), int32_t(length), &status);
+  ubrk_setText(grapheme_cluster_iterator, text.data(), int32_t(length), &status);
+  ASSERT_TRUE(U_SUCCESS(status));
+  for (ssize_t index = 0; index <= length; ++index) {
+    bool is_grapheme_cluster_boundary = ubrk_isBoundary(grapheme_cluster_iterator, int32_t(index));
+    EXPECT_EQ(is_grapheme_cluster_boundary, boundaries.IsGraphemeClusterBoundary(index)) << "at " << index << " of " << utf8_text;
+    bool is_line_break_opportunity = ubrk_isBoundary(line_break_iterator, int32_t(index)) && is_grapheme_cluster_boundary;
+    EXPECT_EQ(is_line_break_opportunity, boundaries.IsLineBreakOpportunity(index)) << "at " << index << " of " << utf8_text;
+    if (index < length) {
+      EXPECT_EQ(ssize_t(ubrk_following(grapheme_cluster_iterator, int32_t(index))), boundaries.NextGraphemeClusterBoundary(index)) << "at " << index << " of " << utf8_text;
+      bool is_whitespace = !U16_IS_TRAIL(text[size_t(index)]) && u_isWhitespace(glyphknit::GetCodepoint(text.data(), length, index));
+      EXPECT_EQ(is_whitespace, boundaries.IsWhitespace(index)) << "at " << index << " of " << utf8_text;
+    }
+  }
+  EXPECT_EQ(length, boundaries.NextGraphemeClusterBoundary(length));
+
+  ubrk_close(grapheme_cluster_iterator);
+  ubrk_close(line_break_iterator);
+}
+
+TEST(ParagraphBoundaries, SameAsIcu) {
+  ExpectSameAsIcu("");
+  ExpectSameAsIcu("a");
+  ExpectSameAsIcu("The quick brown fox\tjumps over the lazy dog.");
+  ExpectSameAsIcu("é ́a b　c");  // combining marks, also after a space, and a no-break space
+  ExpectSameAsIcu("line\r\nbreak ");
+  ExpectSameAsIcu("\U0001F468‍\U0001F469‍\U0001F467 \U0001F1EB\U0001F1F7 \U0001F600!");  // emoji ZWJ sequence, flag and non-BMP
+  ExpectSameAsIcu("吾輩は猫である。名前はまだ無い。");
+  ExpectSameAsIcu("مرحبا بكم في هذا الاختبار");
+  ExpectSameAsIcu("ภาษาไทย ไม่มีช่องว่าง");  // broken with a dictionary
+  ExpectSameAsIcu("Thai ภาษาไทย ไม่มีช่องว่าง in the middle");
+  ExpectSameAsIcu("संयुक्ताक्षर क्ष 한국어 각");  // Indic conjuncts and Hangul
+}
+
+TEST(ParagraphBoundaries, SeveralWords) {
+  // boundaries around and after the 64 code units of the first word of the bitmaps
+  ExpectSameAsIcu("https://www.example.com/a/very/long/path/that/does/not/have/any/space/in/it/index.html?query=typesetting");
+  ExpectSameAsIcu("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\U0001F600aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa é");
+  std::string long_text;
+  for (int i = 0; i < 100; ++i) {
+    long_text += "word́ ";
+  }
+  ExpectSameAsIcu(long_text.c_str());
+}
+
+TEST(ParagraphBoundaries, FindAgain) {
+  // the bitmaps of the previous text must not be kept
+  glyphknit::ParagraphBoundaries boundaries;
+
+  auto first_text = ConvertToUTF16("a b c d");
+  EXPECT_TRUE(boundaries.Find(first_text.data(), ssize_t(first_text.size())));
+  EXPECT_TRUE(boundaries.IsLineBreakOpportunity(2));
+  EXPECT_TRUE(boundaries.IsWhitespace(1));
+
+  auto second_text = ConvertToUTF16("abcdefg");
+  EXPECT_TRUE(boundaries.Find(second_text.data(), ssize_t(second_text.size())));
+  EXPECT_FALSE(boundaries.IsLineBreakOpportunity(2));
+  EXPECT_FALSE(boundaries.IsWhitespace(1));
+  EXPECT_EQ(2, boundaries.NextGraphemeClusterBoundary(1));
+
+  // no line break opportunity is kept when the text needs a dictionary
+  auto third_text = ConvertToUTF16("a b ภาษาไทย");
+  EXPECT_FALSE(boundaries.Find(third_text.data(), ssize_t(third_text.size())));
+  EXPECT_FALSE(boundaries.IsLineBreakOpportunity(2));
+  EXPECT_TRUE(boundaries.IsGraphemeClusterBoundary(2));
+}
+
+TEST(ParagraphBoundaries, FindLineBreakOpportunitiesWithIterator) {
+  UErrorCode status = U_ZERO_ERROR;
+  auto japanese_line_break_iterator = ubrk_open(UBRK_LINE, "ja", nullptr, 0, &status);
+  ASSERT_TRUE(U_SUCCESS(status));
+  glyphknit::ParagraphBoundaries boundaries;
+
+  // only the opportunities in the range given change (Japanese allowing breaks before small kana and the prolonged sound mark)
+  auto text = ConvertToUTF16("ニャーニャー ニャーニャー");
+  EXPECT_TRUE(boundaries.Find(text.data(), ssize_t(text.size())));
+  EXPECT_FALSE(boundaries.IsLineBreakOpportunity(1));
+  EXPECT_FALSE(boundaries.IsLineBreakOpportunity(9));
+  boundaries.FindLineBreakOpportunitiesWithIterator(text.data(), 7, ssize_t(text.size()), japanese_line_break_iterator);
+  EXPECT_FALSE(boundaries.IsLineBreakOpportunity(1));
+  EXPECT_TRUE(boundaries.IsLineBreakOpportunity(3));
+  EXPECT_TRUE(boundaries.IsLineBreakOpportunity(7));
+  EXPECT_TRUE(boundaries.IsLineBreakOpportunity(8));
+  EXPECT_TRUE(boundaries.IsLineBreakOpportunity(9));
+  EXPECT_TRUE(boundaries.IsLineBreakOpportunity(ssize_t(text.size())));
+
+  ubrk_close(japanese_line_break_iterator);
+}
@@ -0,0 +1,287 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "typesetter.hh"
+
+#include "test.h"
+
+TEST(ShapedParagraph, BreakLinesWithoutShaping) {
+  glyphknit::TypesetStats stats;
+  glyphknit::Typesetter typesetter;
+  typesetter.set_stats(&stats);
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText("The quick brown fox jumps over the lazy dog.");
+
+  auto paragraph = typesetter.ShapeParagraph(text_block, 0, text_block.text_length());
+  EXPECT_EQ(1, stats.shape_calls_count);
+  ASSERT_EQ(1u, paragraph.runs().size());
+  for (double width : {50, 100, 200, 1000}) {
+    auto lines = paragraph.BreakLines(width);
+    ASSERT_LT(0u, lines.size());
+    EXPECT_EQ(0, lines.front().start_index);
+    EXPECT_EQ(text_block.text_length(), lines.back().end_index);
+    for (size_t line_index = 0; line_index < lines.size(); ++line_index) {
+      if (line_index > 0) {
+        EXPECT_EQ(lines[line_index - 1].end_index, lines[line_index].start_index);
+      }
+      EXPECT_FALSE(lines[line_index].emergency_break);
+    }
+    if (width < 1000) {
+      EXPECT_LT(1u, lines.size());
+    }
+
+    // all the breaks are between words, where it is safe to break, so nothing has to be shaped again
+    stats.Reset();
+    auto typeset_lines = typesetter.PositionLines(text_block, paragraph, lines);
+    EXPECT_EQ(0, stats.shape_calls_count);
+    ExpectSameGlyphs(typesetter.PositionGlyphs(text_block, width), typeset_lines);
+  }
+}
+
+TEST(ShapedParagraph, Clusters) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  // DejaVu Sans has a ffi ligature: one glyph cluster, but 3 grapheme clusters a line can be cut between
+  text_block.SetText("office a");
+
+  auto paragraph = typesetter.ShapeParagraph(text_block, 0, text_block.text_length());
+  const auto &clusters = paragraph.clusters();
+  ASSERT_EQ(size_t(text_block.text_length()), clusters.size());
+  EXPECT_TRUE(clusters[0].has_flag(glyphknit::ShapedParagraph::kLineBreakOpportunity));
+  EXPECT_EQ(1u, clusters[1].glyphs_count);
+  for (size_t cluster_index : {2, 3}) {
+    EXPECT_EQ(0u, clusters[cluster_index].glyphs_count);
+    EXPECT_EQ(clusters[1].glyph_index, clusters[cluster_index].glyph_index);
+    EXPECT_FALSE(clusters[cluster_index].has_flag(glyphknit::ShapedParagraph::kSafeToBreak));
+    EXPECT_LT(0, clusters[cluster_index].advance);
+  }
+  EXPECT_TRUE(clusters[6].has_flag(glyphknit::ShapedParagraph::kHangingWhitespace));
+  EXPECT_FALSE(clusters[6].has_flag(glyphknit::ShapedParagraph::kLineBreakOpportunity));
+  EXPECT_TRUE(clusters[7].has_flag(glyphknit::ShapedParagraph::kLineBreakOpportunity));
+  EXPECT_TRUE(clusters[7].has_flag(glyphknit::ShapedParagraph::kSafeToBreak));
+
+  auto paragraph_width = paragraph.BreakLines(1000).front().width;
+  double clusters_width = 0;
+  for (const auto &cluster : clusters) {
+    clusters_width += cluster.advance;
+  }
+  EXPECT_DOUBLE_EQ(paragraph_width, clusters_width);
+}
+
+TEST(ShapedParagraph, EmptyParagraph) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText("a\n\nb");
+
+  auto typeset_lines = typesetter.PositionGlyphs(text_block, 100);
+  ASSERT_EQ(3u, typeset_lines.size());
+  EXPECT_TRUE(typeset_lines[1].runs.empty());
+  EXPECT_EQ(typeset_lines[0].height(), typeset_lines[1].height());
+}
+
+TEST(ShapedParagraph, LanguageLineBreakRules) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText("ニャーニャー");
+  auto is_line_break_opportunity = [&](ssize_t index) {
+    auto paragraph = typesetter.ShapeParagraph(text_block, 0, text_block.text_length());
+    for (const auto &cluster : paragraph.clusters()) {
+      if (cluster.start_index == index) {
+        return cluster.has_flag(glyphknit::ShapedParagraph::kLineBreakOpportunity);
+      }
+    }
+    return false;
+  };
+
+  // the default rules do not allow breaks before small kana, but the Japanese ones do
+  // (and Japanese is also the language guessed for kana when no language is set)
+  EXPECT_TRUE(is_line_break_opportunity(1));
+  EXPECT_TRUE(is_line_break_opportunity(3));
+  text_block.SetLanguage(glyphknit::FindLanguageCodeAndOpenTypeLanguageTag("ja"));
+  EXPECT_TRUE(is_line_break_opportunity(1));
+  EXPECT_TRUE(is_line_break_opportunity(2));
+}
+
+TEST(ShapedParagraph, EmergencyBreaksKeepGraphemeClusters) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  auto ExpectLineStarts = [&](const char *text, std::vector<ssize_t> expected_line_starts) {
+    text_block.SetText(text);
+    auto paragraph = typesetter.ShapeParagraph(text_block, 0, text_block.text_length());
+    for (const auto &lines : {paragraph.BreakLines(1), paragraph.BreakLinesOptimally(1, glyphknit::ShapedParagraph::OptimalLineBreakingParameters{})}) {
+      std::vector<ssize_t> line_starts;
+      for (const auto &line : lines) {
+        line_starts.push_back(line.start_index);
+      }
+      EXPECT_EQ(expected_line_starts, line_starts) << text;
+    }
+  };
+  // flags are pairs of regional indicators (each outside of the BMP)
+  ExpectLineStarts("\xF0\x9F\x87\xAF\xF0\x9F\x87\xB5\xF0\x9F\x87\xAB\xF0\x9F\x87\xB7", {0, 4});
+  // a zero width joiner is part of the grapheme cluster before it
+  ExpectLineStarts("a\xE2\x80\x8D" "b", {0, 2});
+  ExpectLineStarts("ab\xE2\x80\x8D" "cd", {0, 1, 3, 4});
+}
+
+TEST(ShapedParagraph, EmergencyBreaksInsideLigaturesFit) {
+  glyphknit::TypesetStats stats;
+  glyphknit::Typesetter typesetter;
+  typesetter.set_stats(&stats);
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  // how much of a ffi ligature fits is guessed from the advances of its characters, and checked by shaping the line
+  text_block.SetText("ffiffiffiffiffiffiffiffiffiffiffiffi");
+  for (double width = 10; width < 60; width += 0.25) {
+    for (const auto &line : typesetter.PositionGlyphs(text_block, width)) {
+      EXPECT_GE(width, LineWidth(line)) << width;
+    }
+  }
+}
+
+static void ExpectContiguousLines(const glyphknit::ShapedParagraph &paragraph, const glyphknit::ShapedParagraph::Lines &lines) {
+  ASSERT_FALSE(lines.empty());
+  EXPECT_EQ(paragraph.start_index(), lines.front().start_index);
+  EXPECT_EQ(paragraph.end_index(), lines.back().end_index);
+  EXPECT_EQ(paragraph.runs().size(), lines.back().end_run_index);
+  for (size_t line_index = 1; line_index < lines.size(); ++line_index) {
+    // the end of a line is the start of the next one, unless a line separator is between them
+    EXPECT_LE(lines[line_index - 1].end_index, lines[line_index].start_index);
+    EXPECT_LE(lines[line_index - 1].start_index, lines[line_index - 1].end_index);
+  }
+}
+
+TEST(ShapedParagraph, BreakLinesOptimally) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{glyphknit::FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSansMono.ttf"), 10};
+  text_block.SetText("aaa bb cc ddddd");
+  auto paragraph = typesetter.ShapeParagraph(text_block, 0, text_block.text_length());
+  auto character_width = paragraph.clusters().front().advance;
+  double available_width = 6 * character_width + 0.5;
+
+  // the greedy line breaking leaves the second line almost empty
+  auto greedy_lines = paragraph.BreakLines(available_width);
+  ASSERT_EQ(3u, greedy_lines.size());
+  EXPECT_EQ(7, greedy_lines[1].start_index);
+  EXPECT_EQ(10, greedy_lines[2].start_index);
+
+  glyphknit::ShapedParagraph::OptimalLineBreakingParameters parameters;
+  auto lines = paragraph.BreakLinesOptimally(available_width, parameters);
+  ExpectContiguousLines(paragraph, lines);
+  ASSERT_EQ(3u, lines.size());
+  EXPECT_EQ(4, lines[1].start_index);
+  EXPECT_EQ(10, lines[2].start_index);
+  EXPECT_DOUBLE_EQ(4 * character_width, lines[0].width);
+  for (const auto &line : lines) {
+    EXPECT_FALSE(line.emergency_break);
+  }
+
+  // a single line when everything fits, as with the greedy line breaking
+  auto wide_lines = paragraph.BreakLinesOptimally(1000, parameters);
+  ASSERT_EQ(1u, wide_lines.size());
+  EXPECT_DOUBLE_EQ(paragraph.BreakLines(1000).front().width, wide_lines.front().width);
+
+  typesetter.set_optimal_line_breaking(&parameters);
+  auto typeset_lines = typesetter.PositionGlyphs(text_block, available_width);
+  ASSERT_EQ(3u, typeset_lines.size());
+  EXPECT_EQ(4, typeset_lines[1].runs.front().glyphs.front().offset);
+}
+
+TEST(ShapedParagraph, BreakLinesOptimallyWithTrailingWhitespace) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  // there is a break opportunity between the spaces and the tab, but all the whitespace at the end of the line still hangs
+  text_block.SetText("ab cd  \t");
+  auto paragraph = typesetter.ShapeParagraph(text_block, 0, text_block.text_length());
+  double max_content_width = paragraph.FindIntrinsicWidths().max_content;
+  ASSERT_EQ(1u, paragraph.BreakLines(max_content_width).size());
+
+  glyphknit::ShapedParagraph::OptimalLineBreakingParameters parameters;
+  auto lines = paragraph.BreakLinesOptimally(max_content_width, parameters);
+  ExpectContiguousLines(paragraph, lines);
+  ASSERT_EQ(1u, lines.size());
+  EXPECT_EQ(text_block.text_length(), lines.front().end_index);
+}
+
+TEST(ShapedParagraph, BreakLinesOptimallyWithEmergencyBreaks) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{glyphknit::FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSansMono.ttf"), 10};
+  text_block.SetText("aa bbbbbbbbbbbbbbbbbbbb cc\u2028dd ee");
+  auto paragraph = typesetter.ShapeParagraph(text_block, 0, text_block.text_length());
+  double available_width = 8 * paragraph.clusters().front().advance + 0.5;
+
+  // the word too wide for a line is only cut between grapheme clusters when it starts a line, and a line separator always ends a line
+  glyphknit::ShapedParagraph::OptimalLineBreakingParameters parameters;
+  auto lines = paragraph.BreakLinesOptimally(available_width, parameters);
+  ExpectContiguousLines(paragraph, lines);
+  ASSERT_EQ(paragraph.BreakLines(available_width).size(), lines.size());
+  ASSERT_EQ(5u, lines.size());
+  EXPECT_EQ(3, lines[0].end_index);
+  EXPECT_FALSE(lines[0].emergency_break);
+  EXPECT_TRUE(lines[1].emergency_break);
+  EXPECT_TRUE(lines[2].emergency_break);
+  EXPECT_EQ(26, lines[3].end_index);
+  EXPECT_FALSE(lines[3].emergency_break);
+  EXPECT_EQ(27, lines[4].start_index);
+  for (const auto &line : lines) {
+    EXPECT_LE(line.width, available_width);
+  }
+
+  // even with a single active break the paragraph can still be broken
+  parameters.max_active_breaks = 1;
+  ExpectContiguousLines(paragraph, paragraph.BreakLinesOptimally(available_width, parameters));
+  ExpectContiguousLines(paragraph, paragraph.BreakLinesOptimally(1, parameters));
+}
+
+TEST(ShapedParagraph, BreakLinesBalanced) {
+  glyphknit::TypesetStats stats;
+  glyphknit::Typesetter typesetter;
+  typesetter.set_stats(&stats);
+  glyphknit::TextBlock text_block{glyphknit::FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSansMono.ttf"), 10};
+  text_block.SetText("aaaa bbbb cccc dddd eeee ff");
+  auto paragraph = typesetter.ShapeParagraph(text_block, 0, text_block.text_length());
+  auto character_width = paragraph.clusters().front().advance;
+  double available_width = 20 * character_width + 0.5;
+
+  // the greedy line breaking puts a single short word on the last line
+  auto greedy_lines = paragraph.BreakLines(available_width);
+  ASSERT_EQ(2u, greedy_lines.size());
+  EXPECT_EQ(20, greedy_lines[1].start_index);
+
+  auto lines = paragraph.BreakLinesBalanced(available_width);
+  ExpectContiguousLines(paragraph, lines);
+  ASSERT_EQ(2u, lines.size());
+  EXPECT_EQ(15, lines[1].start_index);
+  // the first line is as wide as it can be, a bit narrower giving more lines
+  EXPECT_EQ(3u, paragraph.BreakLines(14 * character_width - 0.25).size());
+
+  // nothing to balance with a single line
+  EXPECT_EQ(text_block.text_length(), paragraph.BreakLinesBalanced(1000).front().end_index);
+
+  // the paragraph is only shaped once however many widths are tried
+  stats.Reset();
+  typesetter.set_balanced_line_breaking(true);
+  auto typeset_lines = typesetter.PositionGlyphs(text_block, available_width);
+  ASSERT_EQ(2u, typeset_lines.size());
+  EXPECT_EQ(15, typeset_lines[1].runs.front().glyphs.front().offset);
+  EXPECT_EQ(1, stats.shape_calls_count);
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "typesetter.hh"
+
+#include "test.h"
+
+static hb_segment_properties_t LatinSegmentProperties() {
+  hb_segment_properties_t segment_properties = HB_SEGMENT_PROPERTIES_DEFAULT;
+  segment_properties.direction = HB_DIRECTION_LTR;
+  segment_properties.script = HB_SCRIPT_LATIN;
+  segment_properties.language = hb_language_from_string("en", -1);
+  return segment_properties;
+}
+
+TEST(ShapingCache, FindAndAdd) {
+  auto font_descriptor = LoadTestFont();
+  auto segment_properties = LatinSegmentProperties();
+  const uint16_t text[] = {'a', 'b', ' '};
+  glyphknit::ShapingCache cache;
+
+  EXPECT_EQ(nullptr, cache.Find(font_descriptor, segment_properties, text, 3));
+  EXPECT_EQ(0, cache.hits_count());
+  EXPECT_EQ(1, cache.misses_count());
+
+  cache.Add(font_descriptor, segment_properties, text, 3, glyphknit::ShapingCache::Glyphs{{.id = 1, .cluster_delta = 0, .x_advance = 100}});
+  EXPECT_EQ(1u, cache.entries_count());
+  EXPECT_LT(0u, cache.memory_used());
+  auto glyphs = cache.Find(font_descriptor, segment_properties, text, 3);
+  ASSERT_NE(nullptr, glyphs);
+  ASSERT_EQ(1u, glyphs->size());
+  EXPECT_EQ(100, (*glyphs)[0].x_advance);
+  EXPECT_EQ(1, cache.hits_count());
+
+  // the text, font and segment properties are all part of the key
+  EXPECT_EQ(nullptr, cache.Find(font_descriptor, segment_properties, text, 2));
+  auto rtl_segment_properties = segment_properties;
+  rtl_segment_properties.direction = HB_DIRECTION_RTL;
+  EXPECT_EQ(nullptr, cache.Find(font_descriptor, rtl_segment_properties, text, 3));
+  auto mono_font_descriptor = glyphknit::FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSansMono.ttf");
+  EXPECT_EQ(nullptr, cache.Find(mono_font_descriptor, segment_properties, text, 3));
+  EXPECT_EQ(4, cache.misses_count());
+
+  cache.Clear();
+  EXPECT_EQ(0u, cache.entries_count());
+  EXPECT_EQ(0u, cache.memory_used());
+}
+
+TEST(ShapingCache, MemoryBudget) {
+  auto font_descriptor = LoadTestFont();
+  auto segment_properties = LatinSegmentProperties();
+  glyphknit::ShapingCache cache;
+  const uint16_t text[] = {'a', 'b', 'c', 'd'};
+  for (size_t length = 1; length <= 4; ++length) {
+    cache.Add(font_descriptor, segment_properties, text, length, glyphknit::ShapingCache::Glyphs(length));
+  }
+  EXPECT_EQ(4u, cache.entries_count());
+
+  // makes "a" the most recently used
+  EXPECT_NE(nullptr, cache.Find(font_descriptor, segment_properties, text, 1));
+  cache.set_memory_budget(cache.memory_used() / 2);
+  EXPECT_LE(cache.memory_used(), cache.memory_budget());
+  EXPECT_LT(0u, cache.entries_count());
+  EXPECT_GT(4u, cache.entries_count());
+  EXPECT_NE(nullptr, cache.Find(font_descriptor, segment_properties, text, 1));
+  EXPECT_EQ(nullptr, cache.Find(font_descriptor, segment_properties, text, 2));
+
+  cache.set_memory_budget(0);
+  EXPECT_EQ(0u, cache.entries_count());
+}
+
+TEST(ShapingCache, Typesetter) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  // DejaVu Sans has no kerning between a letter and a space, so the result should be the same with or without the cache
+  for (auto text : {"the cat and the dog and the bird", "שלום עולם שלום", "abc def\nghi abc"}) {
+    text_block.SetText(text);
+    for (double width : {50, 100, 1000}) {
+      typesetter.set_shaping_cache(nullptr);
+      auto expected = typesetter.PositionGlyphs(text_block, width);
+
+      glyphknit::ShapingCache cache;
+      typesetter.set_shaping_cache(&cache);
+      ExpectSameGlyphs(expected, typesetter.PositionGlyphs(text_block, width));
+      EXPECT_LT(0, cache.misses_count());
+      auto misses_count = cache.misses_count();
+      ExpectSameGlyphs(expected, typesetter.PositionGlyphs(text_block, width));
+      EXPECT_EQ(misses_count, cache.misses_count());
+      EXPECT_LT(0, cache.hits_count());
+    }
+  }
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "text_layout.hh"
+
+#include "test.h"
+
+TEST(TextLayout, Resize) {
+  glyphknit::TypesetStats stats;
+  glyphknit::Typesetter typesetter;
+  typesetter.set_stats(&stats);
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText("The quick brown fox jumps over the lazy dog.\n\nשלום עולם abc def\xE2\x80\xA8line separator");
+
+  glyphknit::TextLayout layout{typesetter, text_block};
+  EXPECT_EQ(3u, layout.paragraphs().size());
+  for (double width : {1000, 200, 100, 50}) {
+    auto expected = typesetter.PositionGlyphs(text_block, width);
+    stats.Reset();
+    auto typeset_lines = layout.PositionGlyphs(width);
+    // nothing has to be shaped again as all the breaks are between words
+    EXPECT_EQ(0, stats.shape_calls_count);
+    ExpectSameGlyphs(expected, typeset_lines);
+  }
+}
+
+TEST(TextLayout, LineWidths) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText("The quick brown fox jumps over the lazy dog.\nabc");
+  glyphknit::TextLayout layout{typesetter, text_block};
+
+  // a narrow first line, then wide lines
+  auto typeset_lines = layout.PositionGlyphs(std::vector<double>{30, 1000});
+  ASSERT_EQ(3u, typeset_lines.size());
+  EXPECT_EQ(4u, typeset_lines[0].runs[0].glyphs.size());  // "The "
+  EXPECT_EQ(4, typeset_lines[1].runs[0].glyphs.front().offset);
+
+  // the line indexes continue from one paragraph to the next
+  std::vector<size_t> line_indexes;
+  typeset_lines = layout.PositionGlyphs([&line_indexes](size_t line_index) {
+    line_indexes.push_back(line_index);
+    return line_index == 0 ? 1000 : 10;
+  });
+  ASSERT_EQ(4u, typeset_lines.size());
+  EXPECT_EQ(1u, typeset_lines[1].runs[0].glyphs.size());
+  EXPECT_EQ((std::vector<size_t>{0, 1, 2, 3}), line_indexes);
+}
+
+TEST(TextLayout, LineBreakingOfTheTypesetter) {
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{glyphknit::FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSansMono.ttf"), 10};
+  text_block.SetText("aaa bb cc ddddd\nabc def");
+  glyphknit::TextLayout layout{typesetter, text_block};
+  double available_width = 6 * layout.paragraphs().front().clusters().front().advance + 0.5;
+  EXPECT_EQ(7u, layout.PositionGlyphs(available_width)[0].runs[0].glyphs.size());  // "aaa bb "
+
+  glyphknit::ShapedParagraph::OptimalLineBreakingParameters parameters;
+  typesetter.set_optimal_line_breaking(&parameters);
+  auto typeset_lines = layout.PositionGlyphs(available_width);
+  EXPECT_EQ(4u, typeset_lines[0].runs[0].glyphs.size());  // "aaa "
+  ExpectSameGlyphs(typesetter.PositionGlyphs(text_block, available_width), typeset_lines);
+  typesetter.set_balanced_line_breaking(true);
+  ExpectSameGlyphs(typesetter.PositionGlyphs(text_block, available_width), layout.PositionGlyphs(available_width));
+}
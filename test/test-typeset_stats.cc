@@ -0,0 +1,142 @@
+/*
+ * Copyright © 2014  Vincent Isambart
+ *
+ *  This file is part of Glyphknit.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "typesetter.hh"
+
+#include "test.h"
+
+TEST(TypesetStats, NotGatheredByDefault) {
+  glyphknit::TypesetStats stats;
+  glyphknit::Typesetter typesetter;
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+  text_block.SetText("The quick brown fox jumps over the lazy dog.");
+  typesetter.PositionGlyphs(text_block, 100);
+  EXPECT_EQ(0, stats.paragraphs_count);
+  EXPECT_EQ(0, stats.total_nanoseconds());
+
+  typesetter.set_stats(&stats);
+  typesetter.set_stats(nullptr);
+  typesetter.PositionGlyphs(text_block, 100);
+  EXPECT_EQ(0, stats.shape_calls_count);
+}
+
+TEST(TypesetStats, LineBreaks) {
+  glyphknit::TypesetStats stats;
+  glyphknit::Typesetter typesetter;
+  typesetter.set_stats(&stats);
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+
+  text_block.SetText("Short\nlines");
+  auto typeset_lines = typesetter.PositionGlyphs(text_block, 1000);
+  EXPECT_EQ(2u, typeset_lines.size());
+  EXPECT_EQ(2, stats.paragraphs_count);
+  EXPECT_EQ(2, stats.shape_calls_count);
+  EXPECT_EQ(1, stats.max_shape_calls_per_paragraph);
+  EXPECT_EQ(0, stats.line_break_reshapes_count);
+  EXPECT_EQ(0, stats.grapheme_cluster_breaks_count);
+  EXPECT_GT(stats.phase_nanoseconds[glyphknit::TypesetStats::kShape], 0);
+  EXPECT_GT(stats.total_nanoseconds(), 0);
+
+  // same with layout limits
+  stats.Reset();
+  glyphknit::LayoutLimits limits;
+  limits.max_lines = 10;
+  bool truncated = false;
+  typeset_lines = typesetter.PositionGlyphs(text_block, 1000, limits, &truncated);
+  EXPECT_FALSE(truncated);
+  EXPECT_EQ(2u, typeset_lines.size());
+  EXPECT_EQ(2, stats.paragraphs_count);
+  EXPECT_EQ(2, stats.shape_calls_count);
+  EXPECT_EQ(1, stats.max_shape_calls_per_paragraph);
+
+  stats.Reset();
+  text_block.SetText("The quick brown fox jumps over the lazy dog.");
+  typeset_lines = typesetter.PositionGlyphs(text_block, 100);
+  EXPECT_LT(1u, typeset_lines.size());
+  EXPECT_EQ(1, stats.paragraphs_count);
+  // the glyphs around the spaces do not interact so the run does not have to be shaped again at each line break
+  EXPECT_EQ(int64_t(typeset_lines.size()) - 1, stats.safe_line_breaks_count);
+  EXPECT_EQ(0, stats.line_break_reshapes_count);
+  EXPECT_EQ(1, stats.shape_calls_count);
+  EXPECT_EQ(0, stats.grapheme_cluster_breaks_count);
+  EXPECT_GT(stats.phase_nanoseconds[glyphknit::TypesetStats::kBreakLines], 0);
+
+  stats.Reset();
+  text_block.SetText("aGVsbG8gd29ybGQgdGhpcyBpcyBhIGxvbmcgYmFzZTY0IHN0cmluZw==");
+  typeset_lines = typesetter.PositionGlyphs(text_block, 100);
+  EXPECT_LT(1u, typeset_lines.size());
+  EXPECT_LT(0, stats.grapheme_cluster_breaks_count);
+}
+
+TEST(TypesetStats, FontFallback) {
+  glyphknit::TypesetStats stats;
+  glyphknit::Typesetter typesetter;
+  typesetter.set_stats(&stats);
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+
+  text_block.SetText("abc");
+  typesetter.PositionGlyphs(text_block, 1000);
+  EXPECT_TRUE(stats.fallback_retries_per_font.empty());
+
+  // DejaVu Sans does not have any kanji
+  stats.Reset();
+  text_block.SetText("abc 漢字 def 字");
+  typesetter.PositionGlyphs(text_block, 1000);
+  EXPECT_EQ(3, stats.fallback_retries_per_font["DejaVuSans"]);
+  // no font can display the kanji so there is just one font and each script run is shaped once
+  EXPECT_EQ(4, stats.shape_calls_count);
+}
+
+TEST(TypesetStats, EmergencyBreaks) {
+  glyphknit::TypesetStats stats;
+  glyphknit::Typesetter typesetter;
+  typesetter.set_stats(&stats);
+  glyphknit::TextBlock text_block{LoadTestFont(), 14};
+
+  // DejaVu Sans has a ffi ligature, so the glyph cluster that does not fit on a line can be made of multiple grapheme clusters,
+  // how much of it fits is guessed from the advances of its characters and only the text of each line is shaped again
+  // (once to confirm the guess, and once when positioned)
+  text_block.SetText("ffiffiffiffiffiffiffiffiffiffiffiffi");
+  auto typeset_lines = typesetter.PositionGlyphs(text_block, 20);
+  EXPECT_LT(1u, typeset_lines.size());
+  EXPECT_EQ(int64_t(typeset_lines.size()) - 1, stats.grapheme_cluster_breaks_count);
+  EXPECT_GE(2 * int64_t(typeset_lines.size()) + 1, stats.shape_calls_count);
+
+  // the first glyph cluster of a line is put on it even if it is wider than the line
+  // (DejaVu Sans has no Devanagari so each cluster here is made of multiple .notdef glyphs)
+  text_block.SetText("क्षत्रज्ञ");
+  typeset_lines = typesetter.PositionGlyphs(text_block, 3);
+  EXPECT_LT(1u, typeset_lines.size());
+  for (const auto &line : typeset_lines) {
+    EXPECT_EQ(1u, line.runs.size());
+  }
+}
+
+TEST(TypesetStats, PhaseNames) {
+  EXPECT_STREQ("FindBoundaries", glyphknit::TypesetStats::PhaseName(glyphknit::TypesetStats::kFindBoundaries));
+  EXPECT_STREQ("FontFallback", glyphknit::TypesetStats::PhaseName(glyphknit::TypesetStats::kFontFallback));
+  EXPECT_STREQ("AnalyzeClusters", glyphknit::TypesetStats::PhaseName(glyphknit::TypesetStats::kAnalyzeClusters));
+  EXPECT_STREQ("Output", glyphknit::TypesetStats::PhaseName(glyphknit::TypesetStats::kOutput));
+  EXPECT_STREQ("Cleanup", glyphknit::TypesetStats::PhaseName(glyphknit::TypesetStats::kCleanup));
+}
@@ -36,4 +36,49 @@
 
 #include <iostream>  // for debugging
 
+#include "typesetter.hh"
+
+inline glyphknit::FontDescriptor LoadTestFont() {
+  return glyphknit::FontManager::CreateDescriptorFromLocalFile(GLYPHKNIT_FONTS_DIRECTORY "/dejavu/DejaVuSans.ttf");
+}
+
+inline void ExpectSameGlyphs(const glyphknit::TypesetLine &expected, const glyphknit::TypesetLine &actual) {
+  ASSERT_EQ(expected.runs.size(), actual.runs.size());
+  for (size_t run_index = 0; run_index < expected.runs.size(); ++run_index) {
+    const auto &expected_glyphs = expected.runs[run_index].glyphs;
+    const auto &actual_glyphs = actual.runs[run_index].glyphs;
+    ASSERT_EQ(expected_glyphs.size(), actual_glyphs.size());
+    for (size_t glyph_index = 0; glyph_index < expected_glyphs.size(); ++glyph_index) {
+      EXPECT_EQ(expected_glyphs[glyph_index].id, actual_glyphs[glyph_index].id);
+      EXPECT_EQ(expected_glyphs[glyph_index].offset, actual_glyphs[glyph_index].offset);
+      EXPECT_DOUBLE_EQ(expected_glyphs[glyph_index].x_advance, actual_glyphs[glyph_index].x_advance);
+    }
+  }
+}
+
+inline void ExpectSameGlyphs(const glyphknit::TypesetLines &expected, const glyphknit::TypesetLines &actual) {
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t line_index = 0; line_index < expected.size(); ++line_index) {
+    ExpectSameGlyphs(expected[line_index], actual[line_index]);
+  }
+}
+
+inline double LineWidth(const glyphknit::TypesetLine &line) {
+  double width = 0;
+  for (const auto &run : line.runs) {
+    for (const auto &glyph : run.glyphs) {
+      width += glyph.x_advance;
+    }
+  }
+  return width;
+}
+
+// same glyphs and same metrics
+inline void ExpectSameLine(const glyphknit::TypesetLine &expected, const glyphknit::TypesetLine &actual) {
+  EXPECT_EQ(expected.ascent, actual.ascent);
+  EXPECT_EQ(expected.descent, actual.descent);
+  EXPECT_EQ(expected.leading, actual.leading);
+  ExpectSameGlyphs(expected, actual);
+}
+
 #endif  // GLYPHKNIT_TEST_H_